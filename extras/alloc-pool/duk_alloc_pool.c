@@ -30,7 +30,7 @@ const void *duk_alloc_pool_romptr_high = NULL;
 static void duk__alloc_pool_romptr_init(void);
 #endif
 
-#if defined(DUK_USE_HEAPPTR16)
+#if defined(DUK_USE_HEAPPTR16) || defined(DUK_USE_HEAPPTR32)
 void *duk_alloc_pool_ptrcomp_base = NULL;
 #endif
 
@@ -170,7 +170,7 @@ void *duk_alloc_pool_init(char *buffer,
 #endif
 #endif
 
-#if defined(DUK_USE_HEAPPTR16)
+#if defined(DUK_USE_HEAPPTR16) || defined(DUK_USE_HEAPPTR32)
 	/* Register global base value for pointer compression, assumes
 	 * a single active pool  -4 allows a single subtract to be used and
 	 * still ensures no non-NULL pointer encodes to zero.
@@ -123,13 +123,15 @@ extern const void *duk_alloc_pool_romptr_low;
 extern const void *duk_alloc_pool_romptr_high;
 duk_uint16_t duk_alloc_pool_enc16_rom(void *ptr);
 #endif
-#if defined(DUK_USE_HEAPPTR16)
+#if defined(DUK_USE_HEAPPTR16) || defined(DUK_USE_HEAPPTR32)
 extern void *duk_alloc_pool_ptrcomp_base;
 #endif
 
 #if 0
 duk_uint16_t duk_alloc_pool_enc16(void *ptr);
 void *duk_alloc_pool_dec16(duk_uint16_t val);
+duk_uint32_t duk_alloc_pool_enc32(void *ptr);
+void *duk_alloc_pool_dec32(duk_uint32_t val);
 #endif
 
 /* Inlined pointer compression functions.  Gcc and clang -Os won't in
@@ -224,6 +226,26 @@ static DUK__ALLOC_POOL_ALWAYS_INLINE void *duk_alloc_pool_dec16(duk_uint16_t val
 }
 #endif
 
+#if defined(DUK_USE_HEAPPTR32)
+/* Same encoding as for DUK_USE_HEAPPTR16 but with a 32-bit result, so that
+ * a pool of up to 16GB can be used on 64-bit targets.  ROM pointers are not
+ * supported with DUK_USE_HEAPPTR32.
+ */
+static DUK__ALLOC_POOL_ALWAYS_INLINE duk_uint32_t duk_alloc_pool_enc32(void *ptr) {
+	if (ptr == NULL) {
+		return 0;
+	}
+	return (duk_uint32_t) (((size_t) ((char *) ptr - (char *) duk_alloc_pool_ptrcomp_base)) >> 2);
+}
+
+static DUK__ALLOC_POOL_ALWAYS_INLINE void *duk_alloc_pool_dec32(duk_uint32_t val) {
+	if (val == 0) {
+		return NULL;
+	}
+	return (void *) ((char *) duk_alloc_pool_ptrcomp_base + (((size_t) val) << 2));
+}
+#endif
+
 #if defined(__cplusplus)
 }
 #endif  /* end 'extern "C"' wrapper */
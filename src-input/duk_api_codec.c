@@ -703,6 +703,57 @@ type_error:
 	DUK_ERROR_TYPE(thr, DUK_STR_BASE64_DECODE_FAILED);
 	DUK_WO_NORETURN(return;);
 }
+
+DUK_EXTERNAL duk_size_t duk_base64_decode_into(duk_hthread *thr, duk_idx_t idx, void *buf, duk_size_t buf_size) {
+	const duk_uint8_t *src;
+	duk_size_t srclen;
+	duk_size_t dstlen;
+	duk_size_t reslen;
+	duk_uint8_t *dst;
+	duk_uint8_t *dst_final;
+
+	DUK_ASSERT_API_ENTRY(thr);
+
+	idx = duk_require_normalize_index(thr, idx);
+	src = duk__prep_codec_arg(thr, idx, &srclen);
+	DUK_ASSERT(src != NULL);
+
+	/* The decoder may write up to one group past the final output, see
+	 * duk_base64_decode().  If the caller's buffer has room for the
+	 * worst case decode directly into it, otherwise into a temporary.
+	 */
+	dstlen = (srclen / 4) * 3 + 6;
+	if (buf_size >= dstlen) {
+		DUK_ASSERT(buf != NULL);
+		dst = (duk_uint8_t *) buf;
+		if (!duk__base64_decode_helper(src, srclen, dst, &dst_final)) {
+			goto type_error;
+		}
+		return (duk_size_t) (dst_final - dst);
+	}
+
+	dst = (duk_uint8_t *) duk_push_fixed_buffer_nozero(thr, dstlen);
+	src = duk__prep_codec_arg(thr, idx, &srclen); /* Revalidate after allocation. */
+	DUK_ASSERT(dstlen == (srclen / 4) * 3 + 6);
+	if (!duk__base64_decode_helper(src, srclen, dst, &dst_final)) {
+		goto type_error;
+	}
+	reslen = (duk_size_t) (dst_final - dst);
+	if (reslen > buf_size) {
+		DUK_ERROR_RANGE(thr, DUK_STR_RESULT_TOO_LONG);
+		DUK_WO_NORETURN(return 0;);
+	}
+	if (reslen > 0U) {
+		DUK_ASSERT(buf != NULL);
+		duk_memcpy(buf, (const void *) dst, reslen);
+	}
+	duk_pop_unsafe(thr);
+	return reslen;
+
+type_error:
+	DUK_ERROR_TYPE(thr, DUK_STR_BASE64_DECODE_FAILED);
+	DUK_WO_NORETURN(return 0;);
+}
 #else /* DUK_USE_BASE64_SUPPORT */
 DUK_EXTERNAL const char *duk_base64_encode(duk_hthread *thr, duk_idx_t idx) {
 	DUK_UNREF(idx);
@@ -715,6 +766,14 @@ DUK_EXTERNAL void duk_base64_decode(duk_hthread *thr, duk_idx_t idx) {
 	DUK_ERROR_UNSUPPORTED(thr);
 	DUK_WO_NORETURN(return;);
 }
+
+DUK_EXTERNAL duk_size_t duk_base64_decode_into(duk_hthread *thr, duk_idx_t idx, void *buf, duk_size_t buf_size) {
+	DUK_UNREF(idx);
+	DUK_UNREF(buf);
+	DUK_UNREF(buf_size);
+	DUK_ERROR_UNSUPPORTED(thr);
+	DUK_WO_NORETURN(return 0;);
+}
 #endif /* DUK_USE_BASE64_SUPPORT */
 
 /*
@@ -722,6 +781,74 @@ DUK_EXTERNAL void duk_base64_decode(duk_hthread *thr, duk_idx_t idx) {
  */
 
 #if defined(DUK_USE_HEX_SUPPORT)
+/* Decode 'len' hex digits ('len' must be even) into 'dst' which must have
+ * room for len / 2 bytes.  Returns 0 if the input is invalid; 'dst' may then
+ * have been partially written.
+ */
+DUK_LOCAL duk_bool_t duk__hex_decode_helper(const duk_uint8_t *inp, duk_size_t len, duk_uint8_t *dst) {
+	duk_size_t i;
+	duk_int_t t;
+#if defined(DUK_USE_HEX_FASTPATH)
+	duk_int_t chk;
+	duk_uint8_t *p;
+	duk_size_t len_safe;
+#endif
+
+	DUK_ASSERT((len & 0x01U) == 0U);
+
+#if defined(DUK_USE_HEX_FASTPATH)
+	p = dst;
+	len_safe = len & ~0x07U;
+	for (i = 0; i < len_safe; i += 8) {
+		t = ((duk_int_t) duk_hex_dectab_shift4[inp[i]]) | ((duk_int_t) duk_hex_dectab[inp[i + 1]]);
+		chk = t;
+		p[0] = (duk_uint8_t) t;
+		t = ((duk_int_t) duk_hex_dectab_shift4[inp[i + 2]]) | ((duk_int_t) duk_hex_dectab[inp[i + 3]]);
+		chk |= t;
+		p[1] = (duk_uint8_t) t;
+		t = ((duk_int_t) duk_hex_dectab_shift4[inp[i + 4]]) | ((duk_int_t) duk_hex_dectab[inp[i + 5]]);
+		chk |= t;
+		p[2] = (duk_uint8_t) t;
+		t = ((duk_int_t) duk_hex_dectab_shift4[inp[i + 6]]) | ((duk_int_t) duk_hex_dectab[inp[i + 7]]);
+		chk |= t;
+		p[3] = (duk_uint8_t) t;
+		p += 4;
+
+		/* Check if any lookup above had a negative result. */
+		if (DUK_UNLIKELY(chk < 0)) {
+			return 0;
+		}
+	}
+	for (; i < len; i += 2) {
+		/* First cast to duk_int_t to sign extend, second cast to
+		 * duk_uint_t to avoid signed left shift, and final cast to
+		 * duk_int_t result type.
+		 */
+		t = (duk_int_t) ((((duk_uint_t) (duk_int_t) duk_hex_dectab[inp[i]]) << 4U) |
+		                 ((duk_uint_t) (duk_int_t) duk_hex_dectab[inp[i + 1]]));
+		if (DUK_UNLIKELY(t < 0)) {
+			return 0;
+		}
+		*p++ = (duk_uint8_t) t;
+	}
+#else /* DUK_USE_HEX_FASTPATH */
+	for (i = 0; i < len; i += 2) {
+		/* For invalid characters the value -1 gets extended to
+		 * at least 16 bits.  If either nybble is invalid, the
+		 * resulting 't' will be < 0.
+		 */
+		t = (duk_int_t) ((((duk_uint_t) (duk_int_t) duk_hex_dectab[inp[i]]) << 4U) |
+		                 ((duk_uint_t) (duk_int_t) duk_hex_dectab[inp[i + 1]]));
+		if (DUK_UNLIKELY(t < 0)) {
+			return 0;
+		}
+		dst[i >> 1] = (duk_uint8_t) t;
+	}
+#endif /* DUK_USE_HEX_FASTPATH */
+
+	return 1;
+}
+
 DUK_EXTERNAL const char *duk_hex_encode(duk_hthread *thr, duk_idx_t idx) {
 	const duk_uint8_t *inp;
 	duk_size_t len;
@@ -781,14 +908,7 @@ DUK_EXTERNAL const char *duk_hex_encode(duk_hthread *thr, duk_idx_t idx) {
 DUK_EXTERNAL void duk_hex_decode(duk_hthread *thr, duk_idx_t idx) {
 	const duk_uint8_t *inp;
 	duk_size_t len;
-	duk_size_t i;
-	duk_int_t t;
 	duk_uint8_t *buf;
-#if defined(DUK_USE_HEX_FASTPATH)
-	duk_int_t chk;
-	duk_uint8_t *p;
-	duk_size_t len_safe;
-#endif
 
 	DUK_ASSERT_API_ENTRY(thr);
 
@@ -804,55 +924,9 @@ DUK_EXTERNAL void duk_hex_decode(duk_hthread *thr, duk_idx_t idx) {
 	buf = (duk_uint8_t *) duk_push_fixed_buffer_nozero(thr, len / 2);
 	DUK_ASSERT(buf != NULL);
 
-#if defined(DUK_USE_HEX_FASTPATH)
-	p = buf;
-	len_safe = len & ~0x07U;
-	for (i = 0; i < len_safe; i += 8) {
-		t = ((duk_int_t) duk_hex_dectab_shift4[inp[i]]) | ((duk_int_t) duk_hex_dectab[inp[i + 1]]);
-		chk = t;
-		p[0] = (duk_uint8_t) t;
-		t = ((duk_int_t) duk_hex_dectab_shift4[inp[i + 2]]) | ((duk_int_t) duk_hex_dectab[inp[i + 3]]);
-		chk |= t;
-		p[1] = (duk_uint8_t) t;
-		t = ((duk_int_t) duk_hex_dectab_shift4[inp[i + 4]]) | ((duk_int_t) duk_hex_dectab[inp[i + 5]]);
-		chk |= t;
-		p[2] = (duk_uint8_t) t;
-		t = ((duk_int_t) duk_hex_dectab_shift4[inp[i + 6]]) | ((duk_int_t) duk_hex_dectab[inp[i + 7]]);
-		chk |= t;
-		p[3] = (duk_uint8_t) t;
-		p += 4;
-
-		/* Check if any lookup above had a negative result. */
-		if (DUK_UNLIKELY(chk < 0)) {
-			goto type_error;
-		}
-	}
-	for (; i < len; i += 2) {
-		/* First cast to duk_int_t to sign extend, second cast to
-		 * duk_uint_t to avoid signed left shift, and final cast to
-		 * duk_int_t result type.
-		 */
-		t = (duk_int_t) ((((duk_uint_t) (duk_int_t) duk_hex_dectab[inp[i]]) << 4U) |
-		                 ((duk_uint_t) (duk_int_t) duk_hex_dectab[inp[i + 1]]));
-		if (DUK_UNLIKELY(t < 0)) {
-			goto type_error;
-		}
-		*p++ = (duk_uint8_t) t;
-	}
-#else /* DUK_USE_HEX_FASTPATH */
-	for (i = 0; i < len; i += 2) {
-		/* For invalid characters the value -1 gets extended to
-		 * at least 16 bits.  If either nybble is invalid, the
-		 * resulting 't' will be < 0.
-		 */
-		t = (duk_int_t) ((((duk_uint_t) (duk_int_t) duk_hex_dectab[inp[i]]) << 4U) |
-		                 ((duk_uint_t) (duk_int_t) duk_hex_dectab[inp[i + 1]]));
-		if (DUK_UNLIKELY(t < 0)) {
-			goto type_error;
-		}
-		buf[i >> 1] = (duk_uint8_t) t;
+	if (!duk__hex_decode_helper(inp, len, buf)) {
+		goto type_error;
 	}
-#endif /* DUK_USE_HEX_FASTPATH */
 
 	duk_replace(thr, idx);
 	return;
@@ -861,6 +935,35 @@ type_error:
 	DUK_ERROR_TYPE(thr, DUK_STR_HEX_DECODE_FAILED);
 	DUK_WO_NORETURN(return;);
 }
+
+DUK_EXTERNAL duk_size_t duk_hex_decode_into(duk_hthread *thr, duk_idx_t idx, void *buf, duk_size_t buf_size) {
+	const duk_uint8_t *inp;
+	duk_size_t len;
+
+	DUK_ASSERT_API_ENTRY(thr);
+
+	idx = duk_require_normalize_index(thr, idx);
+	inp = duk__prep_codec_arg(thr, idx, &len);
+	DUK_ASSERT(inp != NULL);
+
+	if (len & 0x01) {
+		goto type_error;
+	}
+	if (len / 2 > buf_size) {
+		DUK_ERROR_RANGE(thr, DUK_STR_RESULT_TOO_LONG);
+		DUK_WO_NORETURN(return 0;);
+	}
+	DUK_ASSERT(buf != NULL || len == 0U);
+
+	if (!duk__hex_decode_helper(inp, len, (duk_uint8_t *) buf)) {
+		goto type_error;
+	}
+	return len / 2;
+
+type_error:
+	DUK_ERROR_TYPE(thr, DUK_STR_HEX_DECODE_FAILED);
+	DUK_WO_NORETURN(return 0;);
+}
 #else /* DUK_USE_HEX_SUPPORT */
 DUK_EXTERNAL const char *duk_hex_encode(duk_hthread *thr, duk_idx_t idx) {
 	DUK_UNREF(idx);
@@ -872,6 +975,13 @@ DUK_EXTERNAL void duk_hex_decode(duk_hthread *thr, duk_idx_t idx) {
 	DUK_ERROR_UNSUPPORTED(thr);
 	DUK_WO_NORETURN(return;);
 }
+DUK_EXTERNAL duk_size_t duk_hex_decode_into(duk_hthread *thr, duk_idx_t idx, void *buf, duk_size_t buf_size) {
+	DUK_UNREF(idx);
+	DUK_UNREF(buf);
+	DUK_UNREF(buf_size);
+	DUK_ERROR_UNSUPPORTED(thr);
+	DUK_WO_NORETURN(return 0;);
+}
 #endif /* DUK_USE_HEX_SUPPORT */
 
 /*
@@ -81,6 +81,36 @@ DUK_EXTERNAL duk_bool_t duk_get_prop_heapptr(duk_hthread *thr, duk_idx_t obj_idx
 	return duk_get_prop(thr, obj_idx);
 }
 
+/* Key handle validation for the _key variants.  The handle is a pinned
+ * duk_hstring (see duk_pin_key()) so it can be used as a property key
+ * directly without interning or a value stack slot.
+ */
+DUK_LOCAL duk_hstring *duk__require_key_handle(duk_hthread *thr, void *key) {
+	if (DUK_UNLIKELY(key == NULL)) {
+		DUK_ERROR_TYPE_INVALID_ARGS(thr);
+		DUK_WO_NORETURN(return NULL;);
+	}
+	DUK_ASSERT(DUK_HEAPHDR_IS_STRING((duk_heaphdr *) key));
+	return (duk_hstring *) key;
+}
+
+DUK_EXTERNAL duk_bool_t duk_get_prop_key(duk_hthread *thr, duk_idx_t obj_idx, void *key) {
+	duk_tval *tv_obj;
+	duk_tval tv_key;
+	duk_bool_t rc;
+
+	DUK_ASSERT_API_ENTRY(thr);
+
+	tv_obj = duk_require_tval(thr, obj_idx);
+	DUK_TVAL_SET_STRING(&tv_key, duk__require_key_handle(thr, key));
+
+	rc = duk_hobject_getprop(thr, tv_obj, &tv_key);
+	DUK_ASSERT(rc == 0 || rc == 1);
+	/* a value is left on stack regardless of rc */
+
+	return rc;
+}
+
 DUK_INTERNAL duk_bool_t duk_get_prop_stridx(duk_hthread *thr, duk_idx_t obj_idx, duk_small_uint_t stridx) {
 	DUK_ASSERT_API_ENTRY(thr);
 	DUK_ASSERT_STRIDX_VALID(stridx);
@@ -246,6 +276,28 @@ DUK_EXTERNAL duk_bool_t duk_put_prop_heapptr(duk_hthread *thr, duk_idx_t obj_idx
 	return duk__put_prop_shared(thr, obj_idx, -1);
 }
 
+DUK_EXTERNAL duk_bool_t duk_put_prop_key(duk_hthread *thr, duk_idx_t obj_idx, void *key) {
+	duk_tval *tv_obj;
+	duk_tval tv_key;
+	duk_tval *tv_val;
+	duk_bool_t throw_flag;
+	duk_bool_t rc;
+
+	DUK_ASSERT_API_ENTRY(thr);
+
+	/* Target object and value may be in the same value stack slot. */
+	tv_obj = duk_require_tval(thr, obj_idx);
+	DUK_TVAL_SET_STRING(&tv_key, duk__require_key_handle(thr, key));
+	tv_val = duk_require_tval(thr, -1);
+	throw_flag = duk_is_strict_call(thr);
+
+	rc = duk_hobject_putprop(thr, tv_obj, &tv_key, tv_val, throw_flag);
+	DUK_ASSERT(rc == 0 || rc == 1);
+
+	duk_pop(thr); /* remove value */
+	return rc;
+}
+
 DUK_INTERNAL duk_bool_t duk_put_prop_stridx(duk_hthread *thr, duk_idx_t obj_idx, duk_small_uint_t stridx) {
 	DUK_ASSERT_API_ENTRY(thr);
 	DUK_ASSERT_STRIDX_VALID(stridx);
@@ -328,6 +380,23 @@ DUK_EXTERNAL duk_bool_t duk_del_prop_heapptr(duk_hthread *thr, duk_idx_t obj_idx
 	return duk_del_prop(thr, obj_idx);
 }
 
+DUK_EXTERNAL duk_bool_t duk_del_prop_key(duk_hthread *thr, duk_idx_t obj_idx, void *key) {
+	duk_tval *tv_obj;
+	duk_tval tv_key;
+	duk_bool_t throw_flag;
+	duk_bool_t rc;
+
+	DUK_ASSERT_API_ENTRY(thr);
+
+	tv_obj = duk_require_tval(thr, obj_idx);
+	DUK_TVAL_SET_STRING(&tv_key, duk__require_key_handle(thr, key));
+	throw_flag = duk_is_strict_call(thr);
+
+	rc = duk_hobject_delprop(thr, tv_obj, &tv_key, throw_flag);
+	DUK_ASSERT(rc == 0 || rc == 1);
+	return rc;
+}
+
 DUK_INTERNAL duk_bool_t duk_del_prop_stridx(duk_hthread *thr, duk_idx_t obj_idx, duk_small_uint_t stridx) {
 	DUK_ASSERT_API_ENTRY(thr);
 	DUK_ASSERT_STRIDX_VALID(stridx);
@@ -411,6 +480,21 @@ DUK_EXTERNAL duk_bool_t duk_has_prop_heapptr(duk_hthread *thr, duk_idx_t obj_idx
 	return duk_has_prop(thr, obj_idx);
 }
 
+DUK_EXTERNAL duk_bool_t duk_has_prop_key(duk_hthread *thr, duk_idx_t obj_idx, void *key) {
+	duk_tval *tv_obj;
+	duk_tval tv_key;
+	duk_bool_t rc;
+
+	DUK_ASSERT_API_ENTRY(thr);
+
+	tv_obj = duk_require_tval(thr, obj_idx);
+	DUK_TVAL_SET_STRING(&tv_key, duk__require_key_handle(thr, key));
+
+	rc = duk_hobject_hasprop(thr, tv_obj, &tv_key);
+	DUK_ASSERT(rc == 0 || rc == 1);
+	return rc;
+}
+
 DUK_INTERNAL duk_bool_t duk_has_prop_stridx(duk_hthread *thr, duk_idx_t obj_idx, duk_small_uint_t stridx) {
 	DUK_ASSERT_API_ENTRY(thr);
 	DUK_ASSERT_STRIDX_VALID(stridx);
@@ -681,12 +765,10 @@ DUK_INTERNAL void duk_seal_freeze_raw(duk_hthread *thr, duk_idx_t obj_idx, duk_b
 			DUK_DD(DUK_DDPRINT("cannot freeze a buffer object"));
 			goto fail_cannot_freeze;
 		}
-		duk_hobject_object_seal_freeze_helper(thr, h, is_freeze);
-
-		/* Sealed and frozen objects cannot gain any more properties,
-		 * so this is a good time to compact them.
+		/* Also compacts the object: sealed and frozen objects cannot
+		 * gain any more properties.
 		 */
-		duk_hobject_compact_props(thr, h);
+		duk_hobject_object_seal_freeze_helper(thr, h, is_freeze);
 		break;
 	default:
 		/* ES2015 Sections 19.1.2.5, 19.1.2.17 */
@@ -748,6 +830,491 @@ DUK_EXTERNAL void duk_put_number_list(duk_hthread *thr, duk_idx_t obj_idx, const
 	}
 }
 
+/*
+ *  Pinned property keys
+ *
+ *  A pinned key is registered as a property key of a bare registry object
+ *  reachable from the heap object, with a pin count as the value.  This
+ *  keeps the duk_hstring reachable for both reference counting and
+ *  mark-and-sweep until it is unpinned, so that its address can be used
+ *  as a stable key handle.
+ */
+
+DUK_LOCAL duk_hobject *duk__get_pinned_keys(duk_hthread *thr, duk_bool_t create) {
+	duk_hobject *h_heap;
+	duk_tval *tv;
+	duk_hobject *h_reg;
+
+	h_heap = thr->heap->heap_object;
+	DUK_ASSERT(h_heap != NULL);
+
+	tv = duk_hobject_find_entry_tval_ptr_stridx(thr->heap, h_heap, DUK_STRIDX_INT_PINNED_KEYS);
+	if (tv != NULL) {
+		DUK_ASSERT(DUK_TVAL_IS_OBJECT(tv));
+		return DUK_TVAL_GET_OBJECT(tv);
+	}
+	if (!create) {
+		return NULL;
+	}
+
+	DUK_DDD(DUK_DDDPRINT("creating pinned key registry on first use"));
+	(void) duk_push_bare_object(thr);
+	h_reg = duk_known_hobject(thr, -1);
+	duk_hobject_define_property_internal(thr,
+	                                     h_heap,
+	                                     DUK_HTHREAD_STRING_INT_PINNED_KEYS(thr),
+	                                     DUK_PROPDESC_FLAGS_C); /* pops registry */
+	return h_reg;
+}
+
+DUK_EXTERNAL void *duk_pin_key(duk_hthread *thr, duk_idx_t idx) {
+	duk_hstring *h_key;
+	duk_hobject *h_reg;
+	duk_tval *tv;
+
+	DUK_ASSERT_API_ENTRY(thr);
+
+	/* Coerce in place so that the caller may also use the key
+	 * from the value stack.
+	 */
+	h_key = duk_to_property_key_hstring(thr, idx);
+	DUK_ASSERT(h_key != NULL);
+
+	h_reg = duk__get_pinned_keys(thr, 1 /*create*/);
+	DUK_ASSERT(h_reg != NULL);
+
+	tv = duk_hobject_find_entry_tval_ptr(thr->heap, h_reg, h_key);
+	if (tv != NULL) {
+		DUK_ASSERT(DUK_TVAL_IS_NUMBER(tv));
+		DUK_TVAL_SET_NUMBER(tv, DUK_TVAL_GET_NUMBER(tv) + 1.0);
+	} else {
+		duk_push_uint(thr, 1);
+		duk_hobject_define_property_internal(thr, h_reg, h_key, DUK_PROPDESC_FLAGS_WC); /* pops count */
+	}
+
+	return (void *) h_key;
+}
+
+DUK_EXTERNAL void duk_unpin_key(duk_hthread *thr, void *key) {
+	duk_hstring *h_key;
+	duk_hobject *h_reg;
+	duk_tval *tv;
+	duk_double_t count;
+
+	DUK_ASSERT_API_ENTRY(thr);
+
+	if (key == NULL) {
+		return;
+	}
+	h_key = (duk_hstring *) key;
+	DUK_ASSERT(DUK_HEAPHDR_IS_STRING((duk_heaphdr *) h_key));
+
+	h_reg = duk__get_pinned_keys(thr, 0 /*create*/);
+	tv = (h_reg != NULL ? duk_hobject_find_entry_tval_ptr(thr->heap, h_reg, h_key) : NULL);
+	if (DUK_UNLIKELY(tv == NULL)) {
+		/* Not pinned: caller error, but harmless to ignore. */
+		DUK_D(DUK_DPRINT("unpin of a key which is not pinned: %!O", (duk_heaphdr *) h_key));
+		return;
+	}
+
+	DUK_ASSERT(DUK_TVAL_IS_NUMBER(tv));
+	count = DUK_TVAL_GET_NUMBER(tv);
+	if (count > 1.0) {
+		DUK_TVAL_SET_NUMBER(tv, count - 1.0);
+	} else {
+		/* May free the key string; the handle becomes invalid. */
+		(void) duk_hobject_delprop_raw(thr, h_reg, h_key, 0 /*flags*/);
+	}
+}
+
+/*
+ *  Batched field transfer between C structs and objects
+ *
+ *  Field list keys are interned via the literal cache (when enabled): they
+ *  are expected to be string literals in a static table, so their address
+ *  is a stable cache key and repeated transfers skip string table lookups.
+ *  Key and value are written into scratch value stack slots which are
+ *  reused for all fields, avoiding per-field index validation and value
+ *  stack churn.
+ */
+
+DUK_LOCAL duk_hstring *duk__field_list_intern(duk_hthread *thr, const char *str, duk_bool_t is_key) {
+	duk_size_t len;
+
+	DUK_ASSERT(str != NULL);
+
+	len = DUK_STRLEN(str);
+	if (DUK_UNLIKELY(len > DUK_HSTRING_MAX_BYTELEN)) {
+		DUK_ERROR_RANGE(thr, DUK_STR_STRING_TOO_LONG);
+		DUK_WO_NORETURN(return NULL;);
+	}
+#if defined(DUK_USE_LITCACHE_SIZE)
+	if (is_key) {
+		return duk_heap_strtable_intern_literal_checked(thr, (const duk_uint8_t *) str, (duk_uint32_t) len);
+	}
+#else
+	DUK_UNREF(is_key);
+#endif
+	return duk_heap_strtable_intern_checked(thr, (const duk_uint8_t *) str, (duk_uint32_t) len);
+}
+
+/* Own data property value pointer for an ordinary object, or NULL if the
+ * full property algorithm is needed.
+ */
+DUK_LOCAL duk_tval *duk__field_list_own_data_ptr(duk_hthread *thr, duk_idx_t obj_idx, duk_hstring *key, duk_uint_t required_attrs) {
+	duk_tval *tv_obj;
+	duk_hobject *obj;
+	duk_tval *tv;
+	duk_uint_t attrs;
+
+	tv_obj = DUK_GET_TVAL_POSIDX(thr, obj_idx);
+	if (!DUK_TVAL_IS_OBJECT(tv_obj)) {
+		return NULL;
+	}
+	obj = DUK_TVAL_GET_OBJECT(tv_obj);
+	DUK_ASSERT(obj != NULL);
+	if (DUK_HOBJECT_HAS_EXOTIC_BEHAVIOR(obj)) {
+		return NULL;
+	}
+	tv = duk_hobject_find_entry_tval_ptr_and_attrs(thr->heap, obj, key, &attrs);
+	if (tv == NULL || (attrs & required_attrs) != required_attrs) {
+		return NULL;
+	}
+	return tv;
+}
+
+DUK_EXTERNAL void duk_put_field_list(duk_hthread *thr, duk_idx_t obj_idx, const duk_field_list_entry *fields, const void *src) {
+	const duk_field_list_entry *ent = fields;
+	const duk_uint8_t *p;
+	duk_hstring *h;
+	duk_hstring *h_val;
+	duk_tval *tv;
+	duk_bool_t throw_flag;
+
+	DUK_ASSERT_API_ENTRY(thr);
+
+	obj_idx = duk_require_normalize_index(thr, obj_idx);
+	if (ent == NULL || ent->key == NULL) {
+		return;
+	}
+	if (DUK_UNLIKELY(src == NULL)) {
+		DUK_ERROR_TYPE_INVALID_ARGS(thr);
+		DUK_WO_NORETURN(return;);
+	}
+	throw_flag = duk_is_strict_call(thr);
+
+	duk_push_undefined(thr); /* key */
+	duk_push_undefined(thr); /* value */
+
+	/* [ ... obj ... key value ] */
+
+	while (ent->key != NULL) {
+		/* Interning may trigger a GC and a value stack resize, so
+		 * look up the slots only after it.  Previous key and value
+		 * are primitives so their DECREF has no side effects.
+		 */
+		h = duk__field_list_intern(thr, ent->key, 1 /*is_key*/);
+		tv = thr->valstack_top - 2;
+		DUK_TVAL_SET_STRING_UPDREF(thr, tv, h);
+
+		p = (const duk_uint8_t *) src + ent->offset;
+		switch (ent->type) {
+		case DUK_FIELD_BOOLEAN:
+			tv = thr->valstack_top - 1;
+			DUK_TVAL_SET_BOOLEAN_UPDREF(thr, tv, (*(const duk_bool_t *) (const void *) p != 0));
+			break;
+		case DUK_FIELD_INT:
+			tv = thr->valstack_top - 1;
+			DUK_TVAL_SET_NUMBER_CHKFAST_UPDREF(thr, tv, (duk_double_t) *(const duk_int_t *) (const void *) p);
+			break;
+		case DUK_FIELD_UINT:
+			tv = thr->valstack_top - 1;
+			DUK_TVAL_SET_NUMBER_CHKFAST_UPDREF(thr, tv, (duk_double_t) *(const duk_uint_t *) (const void *) p);
+			break;
+		case DUK_FIELD_INT32:
+			tv = thr->valstack_top - 1;
+			DUK_TVAL_SET_I32_UPDREF(thr, tv, *(const duk_int32_t *) (const void *) p);
+			break;
+		case DUK_FIELD_UINT32:
+			tv = thr->valstack_top - 1;
+			DUK_TVAL_SET_U32_UPDREF(thr, tv, *(const duk_uint32_t *) (const void *) p);
+			break;
+		case DUK_FIELD_DOUBLE: {
+			duk_double_union du;
+			du.d = *(const duk_double_t *) (const void *) p;
+			DUK_DBLUNION_NORMALIZE_NAN_CHECK(&du);
+			tv = thr->valstack_top - 1;
+			DUK_TVAL_SET_NUMBER_UPDREF(thr, tv, du.d);
+			break;
+		}
+		case DUK_FIELD_STRING: {
+			const char *str = *(const char *const *) (const void *) p;
+			if (str == NULL) {
+				tv = thr->valstack_top - 1;
+				DUK_TVAL_SET_NULL_UPDREF(thr, tv);
+			} else {
+				/* 'h' must remain the key for the fast path below. */
+				h_val = duk__field_list_intern(thr, str, 0 /*is_key*/);
+				tv = thr->valstack_top - 1;
+				DUK_TVAL_SET_STRING_UPDREF(thr, tv, h_val);
+			}
+			break;
+		}
+		case DUK_FIELD_POINTER:
+			tv = thr->valstack_top - 1;
+			DUK_TVAL_SET_POINTER_UPDREF(thr, tv, *(void *const *) (const void *) p);
+			break;
+		default:
+			DUK_ERROR_TYPE_INVALID_ARGS(thr);
+			DUK_WO_NORETURN(return;);
+		}
+
+		/* Fast path: overwrite an existing writable own data property
+		 * of an ordinary object in place.  Anything else (accessors,
+		 * inherited or missing properties, exotic objects) goes
+		 * through the full [[Put]] algorithm.
+		 */
+		tv = duk__field_list_own_data_ptr(thr, obj_idx, h, DUK_PROPDESC_FLAG_WRITABLE);
+		if (tv != NULL) {
+			DUK_TVAL_SET_TVAL_UPDREF(thr, tv, thr->valstack_top - 1);
+		} else {
+			(void) duk_hobject_putprop(thr,
+			                           DUK_GET_TVAL_POSIDX(thr, obj_idx),
+			                           thr->valstack_top - 2,
+			                           thr->valstack_top - 1,
+			                           throw_flag);
+		}
+		ent++;
+	}
+
+	duk_pop_2_unsafe(thr);
+}
+
+DUK_EXTERNAL duk_uint_t duk_get_field_list(duk_hthread *thr, duk_idx_t obj_idx, const duk_field_list_entry *fields, void *dst) {
+	const duk_field_list_entry *ent = fields;
+	duk_uint8_t *p;
+	duk_hstring *h;
+	duk_tval *tv;
+	duk_uint_t count = 0;
+	duk_bool_t own_data;
+
+	DUK_ASSERT_API_ENTRY(thr);
+
+	obj_idx = duk_require_normalize_index(thr, obj_idx);
+	if (ent == NULL || ent->key == NULL) {
+		return 0;
+	}
+	if (DUK_UNLIKELY(dst == NULL)) {
+		DUK_ERROR_TYPE_INVALID_ARGS(thr);
+		DUK_WO_NORETURN(return 0;);
+	}
+
+	duk_push_undefined(thr); /* key */
+
+	/* [ ... obj ... key ] */
+
+	while (ent->key != NULL) {
+		h = duk__field_list_intern(thr, ent->key, 1 /*is_key*/);
+		tv = thr->valstack_top - 1;
+		DUK_TVAL_SET_STRING_UPDREF(thr, tv, h);
+
+		tv = duk__field_list_own_data_ptr(thr, obj_idx, h, 0 /*required_attrs*/);
+		own_data = (tv != NULL);
+		if (own_data) {
+			duk_push_tval(thr, tv);
+		} else {
+			(void) duk_hobject_getprop(thr, DUK_GET_TVAL_POSIDX(thr, obj_idx), thr->valstack_top - 1);
+		}
+
+		/* [ ... obj ... key value ] */
+
+		/* An undefined (or missing) property leaves the C field
+		 * untouched so that the caller can prefill defaults.
+		 */
+		if (!DUK_TVAL_IS_UNDEFINED(thr->valstack_top - 1)) {
+			p = (duk_uint8_t *) dst + ent->offset;
+			switch (ent->type) {
+			case DUK_FIELD_BOOLEAN:
+				*(duk_bool_t *) (void *) p = duk_to_boolean(thr, -1);
+				break;
+			case DUK_FIELD_INT:
+				*(duk_int_t *) (void *) p = duk_to_int(thr, -1);
+				break;
+			case DUK_FIELD_UINT:
+				*(duk_uint_t *) (void *) p = duk_to_uint(thr, -1);
+				break;
+			case DUK_FIELD_INT32:
+				*(duk_int32_t *) (void *) p = duk_to_int32(thr, -1);
+				break;
+			case DUK_FIELD_UINT32:
+				*(duk_uint32_t *) (void *) p = duk_to_uint32(thr, -1);
+				break;
+			case DUK_FIELD_DOUBLE:
+				*(duk_double_t *) (void *) p = duk_to_number_m1(thr);
+				break;
+			case DUK_FIELD_STRING:
+				/* Borrowed from the object, so only an own data
+				 * property is reachable after the value is popped.
+				 * A string from a getter, a Proxy trap, etc. may
+				 * have no other references and is written as NULL.
+				 */
+				*(const char **) (void *) p = own_data ? duk_get_string(thr, -1) : NULL;
+				break;
+			case DUK_FIELD_POINTER:
+				*(void **) (void *) p = duk_get_pointer(thr, -1);
+				break;
+			default:
+				DUK_ERROR_TYPE_INVALID_ARGS(thr);
+				DUK_WO_NORETURN(return 0;);
+			}
+			count++;
+		}
+
+		duk_pop_unsafe(thr);
+		ent++;
+	}
+
+	duk_pop_unsafe(thr);
+	return count;
+}
+
+/*
+ *  Bulk transfer of numeric array elements
+ *
+ *  Dense arrays are read and written directly through the array part.
+ *  Other values (gaps, non-numbers, non-Array objects, indices outside
+ *  the array part) are handled per element with an ordinary [[Get]] and
+ *  a ToNumber() / ToInt32() coercion.  Coercion may have side effects
+ *  which can resize or abandon the array part, so the fast path
+ *  conditions are rechecked for every element.
+ */
+
+DUK_LOCAL duk_idx_t duk__push_array_numbers(duk_hthread *thr, const void *values, duk_size_t count, duk_bool_t is_int32) {
+	duk_tval *tv_dst;
+	duk_size_t i;
+
+	DUK_ASSERT_API_ENTRY(thr);
+
+	if (DUK_UNLIKELY(count > (duk_size_t) DUK_UINT32_MAX || count > DUK_SIZE_MAX / sizeof(duk_tval))) {
+		DUK_ERROR_RANGE_INVALID_LENGTH(thr);
+		DUK_WO_NORETURN(return 0;);
+	}
+	if (DUK_UNLIKELY(values == NULL && count > 0)) {
+		DUK_ERROR_TYPE_INVALID_ARGS(thr);
+		DUK_WO_NORETURN(return 0;);
+	}
+
+	tv_dst = duk_push_harray_with_size_outptr(thr, (duk_uint32_t) count);
+	DUK_ASSERT(count == 0 || tv_dst != NULL);
+
+	/* Array part entries are initialized to 'unused' and numbers are
+	 * not refcounted, so plain writes suffice.
+	 */
+	if (is_int32) {
+		const duk_int32_t *p = (const duk_int32_t *) values;
+		for (i = 0; i < count; i++) {
+			DUK_TVAL_SET_I32(tv_dst, p[i]);
+			tv_dst++;
+		}
+	} else {
+		const duk_double_t *p = (const duk_double_t *) values;
+		duk_double_union du;
+		for (i = 0; i < count; i++) {
+			du.d = p[i];
+			DUK_DBLUNION_NORMALIZE_NAN_CHECK(&du);
+			DUK_TVAL_SET_NUMBER_CHKFAST_FAST(tv_dst, du.d);
+			tv_dst++;
+		}
+	}
+
+	return duk_get_top_index_unsafe(thr);
+}
+
+DUK_EXTERNAL duk_idx_t duk_push_array_doubles(duk_hthread *thr, const duk_double_t *values, duk_size_t count) {
+	return duk__push_array_numbers(thr, (const void *) values, count, 0 /*is_int32*/);
+}
+
+DUK_EXTERNAL duk_idx_t duk_push_array_int32s(duk_hthread *thr, const duk_int32_t *values, duk_size_t count) {
+	return duk__push_array_numbers(thr, (const void *) values, count, 1 /*is_int32*/);
+}
+
+DUK_LOCAL duk_size_t
+duk__get_array_numbers(duk_hthread *thr, duk_idx_t idx, duk_uarridx_t start, void *out, duk_size_t count, duk_bool_t is_int32) {
+	duk_hobject *h;
+	duk_size_t len;
+	duk_size_t n;
+	duk_size_t i;
+	duk_uarridx_t arr_idx;
+	duk_double_t d;
+	duk_int32_t i32;
+
+	DUK_ASSERT_API_ENTRY(thr);
+
+	idx = duk_require_normalize_index(thr, idx);
+	h = duk_require_hobject(thr, idx);
+	DUK_ASSERT(h != NULL);
+	DUK_UNREF(h); /* Only used by the array fast path. */
+
+	/* The initial 'length' decides the number of elements copied
+	 * regardless of side effects during the copy.
+	 */
+	len = duk_get_length(thr, idx);
+	if (start >= len) {
+		return 0;
+	}
+	n = len - (duk_size_t) start;
+	if (count < n) {
+		n = count;
+	}
+	if (DUK_UNLIKELY(out == NULL && n > 0)) {
+		DUK_ERROR_TYPE_INVALID_ARGS(thr);
+		DUK_WO_NORETURN(return 0;);
+	}
+
+	for (i = 0; i < n; i++) {
+		arr_idx = (duk_uarridx_t) (start + i);
+
+#if defined(DUK_USE_ARRAY_FASTPATH)
+		if (DUK_LIKELY(DUK_HOBJECT_IS_ARRAY(h) && arr_idx < ((duk_harray *) h)->length &&
+		               arr_idx < DUK_HOBJECT_GET_ASIZE(h))) {
+			duk_tval *tv;
+
+			tv = DUK_HOBJECT_A_GET_VALUE_PTR(thr->heap, h, arr_idx);
+			if (DUK_LIKELY(DUK_TVAL_IS_NUMBER(tv))) {
+				if (is_int32) {
+					((duk_int32_t *) out)[i] = duk_js_toint32(thr, tv); /* no side effects for numbers */
+				} else {
+					((duk_double_t *) out)[i] = DUK_TVAL_GET_NUMBER(tv);
+				}
+				continue;
+			}
+		}
+#endif /* DUK_USE_ARRAY_FASTPATH */
+
+		(void) duk_get_prop_index(thr, idx, arr_idx);
+		if (is_int32) {
+			i32 = duk_to_int32(thr, -1);
+			((duk_int32_t *) out)[i] = i32;
+		} else {
+			d = duk_to_number_m1(thr);
+			((duk_double_t *) out)[i] = d;
+		}
+		duk_pop_unsafe(thr);
+	}
+
+	return n;
+}
+
+DUK_EXTERNAL duk_size_t
+duk_get_array_doubles(duk_hthread *thr, duk_idx_t idx, duk_uarridx_t start, duk_double_t *out, duk_size_t count) {
+	return duk__get_array_numbers(thr, idx, start, (void *) out, count, 0 /*is_int32*/);
+}
+
+DUK_EXTERNAL duk_size_t
+duk_get_array_int32s(duk_hthread *thr, duk_idx_t idx, duk_uarridx_t start, duk_int32_t *out, duk_size_t count) {
+	return duk__get_array_numbers(thr, idx, start, (void *) out, count, 1 /*is_int32*/);
+}
+
 /*
  *  Shortcut for accessing global object properties
  */
@@ -3487,8 +3487,25 @@ DUK_EXTERNAL const char *duk_to_string(duk_hthread *thr, duk_idx_t idx) {
 #endif
 	default: {
 		/* number */
+		duk_double_t d;
+		duk_uint32_t uval;
+
 		DUK_ASSERT(!DUK_TVAL_IS_UNUSED(tv));
 		DUK_ASSERT(DUK_TVAL_IS_NUMBER(tv));
+
+		/* Non-negative integers (array indices in particular) are
+		 * very common, intern them directly through the integer
+		 * string cache.  -0 also formats as "0".
+		 */
+		d = DUK_TVAL_GET_NUMBER(tv);
+		if (d >= 0.0 && d <= 4294967295.0) {
+			uval = duk_double_to_uint32_t(d);
+			if (duk_double_equals((duk_double_t) uval, d)) {
+				duk_push_hstring(thr, duk_heap_strtable_intern_u32_checked(thr, uval));
+				break;
+			}
+		}
+
 		duk_push_tval(thr, tv);
 		duk_numconv_stringify(thr, 10 /*radix*/, 0 /*precision:shortest*/, 0 /*force_exponential*/);
 		break;
@@ -4568,9 +4585,13 @@ DUK_INTERNAL duk_hstring *duk_push_uint_to_hstring(duk_hthread *thr, duk_uint_t
 
 	DUK_ASSERT_API_ENTRY(thr);
 
-	/* XXX: this could be a direct DUK_SPRINTF to a buffer followed by duk_push_string() */
+#if (DUK_UINT_MAX <= 0xffffffffUL)
+	h_tmp = duk_heap_strtable_intern_u32_checked(thr, (duk_uint32_t) i);
+	duk_push_hstring(thr, h_tmp);
+#else
 	duk_push_uint(thr, (duk_uint_t) i);
 	h_tmp = duk_to_hstring_m1(thr);
+#endif
 	DUK_ASSERT(h_tmp != NULL);
 	return h_tmp;
 }
@@ -5016,7 +5037,7 @@ DUK_EXTERNAL duk_idx_t duk_push_thread_raw(duk_hthread *thr, duk_uint_t flags) {
 #if defined(DUK_USE_ROM_STRINGS)
 	/* Nothing to initialize, strs[] is in ROM. */
 #else
-#if defined(DUK_USE_HEAPPTR16)
+#if defined(DUK_HEAPPTR_COMPRESSED)
 	obj->strs16 = thr->strs16;
 #else
 	obj->strs = thr->strs;
@@ -5754,9 +5775,10 @@ DUK_LOCAL void duk__validate_push_heapptr(duk_hthread *thr, void *ptr) {
 
 #if defined(DUK_USE_REFERENCE_COUNTING)
 	/* Because refzero_list is now processed to completion inline with
-	 * no side effects, it's always empty here.
+	 * no side effects, it's always empty here (or a suspended cascade
+	 * with DUK_USE_REFZERO_BUDGET, whose objects are unreachable).
 	 */
-	DUK_ASSERT(thr->heap->refzero_list == NULL);
+	DUK_ASSERT(!DUK_HEAP_REFZERO_ACTIVE(thr->heap));
 #endif
 
 	/* If not present in finalize_list (or refzero_list), it
@@ -5770,7 +5792,7 @@ DUK_LOCAL void duk__validate_push_heapptr(duk_hthread *thr, void *ptr) {
 		DUK_ASSERT(found == 0);
 		for (i = 0; i < heap->st_size; i++) {
 #if defined(DUK_USE_STRTAB_PTRCOMP)
-			str = DUK_USE_HEAPPTR_DEC16((heap)->heap_udata, heap->strtable16[i]);
+			str = DUK_HEAPPTR_DEC((heap)->heap_udata, heap->strtable16[i]);
 #else
 			str = heap->strtable[i];
 #endif
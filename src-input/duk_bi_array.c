@@ -133,8 +133,93 @@ DUK_LOCAL duk_harray *duk__arraypart_fastpath_this(duk_hthread *thr) {
 	DUK_DD(DUK_DDPRINT("array fast path allowed for: %!O", (duk_heaphdr *) h));
 	return (duk_harray *) h;
 }
+
+/* Get a pointer to element 'idx' of 'h' if 'h' is an Array instance and the
+ * element is present in the array part, NULL otherwise.  A present element
+ * is an own data property so its value can be read directly, without any
+ * side effects.  Entries at or above 'length' are always unused, so no
+ * separate 'length' check is needed.  The pointer is only valid until the
+ * next side effect.
+ */
+DUK_LOCAL duk_tval *duk__arraypart_get_tval(duk_hthread *thr, duk_hobject *h, duk_uint32_t idx) {
+	duk_tval *tv;
+
+	DUK_UNREF(thr);
+
+	if (h == NULL || !DUK_HOBJECT_HAS_EXOTIC_ARRAY(h) || !DUK_HOBJECT_HAS_ARRAY_PART(h) || idx >= DUK_HOBJECT_GET_ASIZE(h)) {
+		return NULL;
+	}
+	tv = DUK_HOBJECT_A_GET_BASE(thr->heap, h) + idx;
+	if (DUK_TVAL_IS_UNUSED(tv)) {
+		return NULL;
+	}
+	return tv;
+}
+
+/* Like duk__arraypart_get_tval() but for a whole index range [start,end[:
+ * return a pointer to the array part base if every element in the range is
+ * present, NULL otherwise (including when there are gaps, which would need
+ * an inherited lookup).
+ */
+DUK_LOCAL duk_tval *duk__arraypart_get_dense_range(duk_hthread *thr, duk_hobject *h, duk_uint32_t start, duk_uint32_t end) {
+	duk_tval *tv_base;
+	duk_uint32_t i;
+
+	DUK_ASSERT(start <= end);
+	DUK_UNREF(thr);
+
+	if (h == NULL || !DUK_HOBJECT_HAS_EXOTIC_ARRAY(h) || !DUK_HOBJECT_HAS_ARRAY_PART(h) || end > DUK_HOBJECT_GET_ASIZE(h)) {
+		return NULL;
+	}
+	tv_base = DUK_HOBJECT_A_GET_BASE(thr->heap, h);
+	for (i = start; i < end; i++) {
+		if (DUK_TVAL_IS_UNUSED(tv_base + i)) {
+			DUK_DD(DUK_DDPRINT("reject dense range fast path: gap at index %ld", (long) i));
+			return NULL;
+		}
+	}
+	return tv_base;
+}
 #endif /* DUK_USE_ARRAY_FASTPATH */
 
+/* Push obj[idx] and return 1 if the property exists, like
+ * duk_get_prop_index().  Array part elements of Array instances are read
+ * directly, everything else goes through a full [[Get]].
+ */
+DUK_LOCAL duk_bool_t duk__get_prop_index_fast(duk_hthread *thr, duk_idx_t obj_idx, duk_uarridx_t idx) {
+#if defined(DUK_USE_ARRAY_FASTPATH)
+	duk_tval *tv;
+
+	tv = duk__arraypart_get_tval(thr, duk_get_hobject(thr, obj_idx), (duk_uint32_t) idx);
+	if (tv != NULL) {
+		duk_push_tval(thr, tv);
+		return 1;
+	}
+#endif
+	return duk_get_prop_index(thr, obj_idx, idx);
+}
+
+/* Combined [[HasProperty]] and [[Get]] for algorithms which check for an
+ * element before reading it.  If the element exists, push its value and
+ * return 1, otherwise push nothing and return 0.
+ */
+DUK_LOCAL duk_bool_t duk__has_get_prop_index(duk_hthread *thr, duk_idx_t obj_idx, duk_uarridx_t idx) {
+#if defined(DUK_USE_ARRAY_FASTPATH)
+	duk_tval *tv;
+
+	tv = duk__arraypart_get_tval(thr, duk_get_hobject(thr, obj_idx), (duk_uint32_t) idx);
+	if (tv != NULL) {
+		duk_push_tval(thr, tv);
+		return 1;
+	}
+#endif
+	if (!duk_has_prop_index(thr, obj_idx, idx)) {
+		return 0;
+	}
+	(void) duk_get_prop_index(thr, obj_idx, idx);
+	return 1;
+}
+
 /*
  *  Constructor
  */
@@ -318,7 +403,7 @@ DUK_INTERNAL duk_ret_t duk_bi_array_prototype_concat(duk_hthread *thr) {
 					duk_xdef_prop_index_wec(thr, -2, idx);
 				}
 			} else {
-				if (duk_get_prop_index(thr, i, j)) {
+				if (duk__get_prop_index_fast(thr, i, j)) {
 					duk_xdef_prop_index_wec(thr, -2, idx);
 				} else {
 					duk_pop_undefined(thr);
@@ -358,6 +443,139 @@ fail_wrap:
  *  There is no fancy handling; the prefix gets re-joined multiple times.
  */
 
+#if defined(DUK_USE_ARRAY_FASTPATH)
+/* Get the ToString() result of a join() element as a byte range without
+ * creating a string, formatting numbers into 'numbuf' if necessary.
+ * Returns 0 if the element needs a full ToString() coercion (objects,
+ * symbols, non-integer numbers, etc).
+ */
+DUK_LOCAL duk_bool_t duk__array_join_get_part(duk_hthread *thr,
+                                              duk_tval *tv,
+                                              duk_uint8_t *numbuf,
+                                              const duk_uint8_t **out_data,
+                                              duk_size_t *out_blen) {
+	duk_hstring *h;
+
+	DUK_UNREF(thr); /* Unused with ROM strings. */
+
+	switch (DUK_TVAL_GET_TAG(tv)) {
+	case DUK_TAG_UNDEFINED:
+	case DUK_TAG_NULL:
+		*out_data = NULL;
+		*out_blen = 0;
+		return 1;
+	case DUK_TAG_BOOLEAN:
+		h = DUK_HTHREAD_GET_STRING(thr, DUK_TVAL_GET_BOOLEAN(tv) ? DUK_STRIDX_TRUE : DUK_STRIDX_FALSE);
+		break;
+	case DUK_TAG_STRING:
+		h = DUK_TVAL_GET_STRING(tv);
+		if (DUK_UNLIKELY(DUK_HSTRING_HAS_SYMBOL(h))) {
+			return 0;
+		}
+		break;
+	default:
+		/* Numbers (including fastints) and other types. */
+		if (DUK_TVAL_IS_NUMBER(tv)) {
+			*out_blen = (duk_size_t) duk_numconv_format_integer(numbuf, DUK_TVAL_GET_NUMBER(tv));
+			*out_data = numbuf;
+			return (*out_blen > 0);
+		}
+		return 0;
+	}
+
+	*out_data = duk_hstring_get_data_and_bytelen(h, out_blen);
+	return 1;
+}
+
+/* Two pass join() for a dense Array whose elements are all undefined, null,
+ * booleans, strings, or integers: the first pass measures the result, the
+ * second copies the parts into an exact size buffer which is then interned.
+ * No intermediate strings are created.  Return 0 if the generic algorithm
+ * is needed.
+ */
+DUK_LOCAL duk_bool_t duk__array_join_fastpath(duk_hthread *thr, duk_uint32_t len) {
+	duk_hobject *h;
+	duk_tval *tv_base;
+	const duk_uint8_t *sep_data;
+	duk_size_t sep_blen;
+	const duk_uint8_t *part_data;
+	duk_size_t part_blen;
+	duk_uint8_t numbuf[DUK_NUMCONV_INTEGER_MAXLEN];
+	duk_size_t total;
+	duk_uint8_t *buf;
+	duk_uint8_t *p;
+	duk_uint8_t *p_end;
+	duk_uint32_t i;
+
+	/* [ sep ToObject(this) len ] */
+
+	h = duk_get_hobject(thr, 1);
+	tv_base = duk__arraypart_get_dense_range(thr, h, 0, len);
+	if (tv_base == NULL || len == 0) {
+		return 0;
+	}
+	sep_data = duk_hstring_get_data_and_bytelen(duk_known_hstring(thr, 0), &sep_blen);
+
+	total = 0;
+	for (i = 0; i < len; i++) {
+		if (!duk__array_join_get_part(thr, tv_base + i, numbuf, &part_data, &part_blen)) {
+			DUK_DD(DUK_DDPRINT("reject join fast path: element %ld needs coercion", (long) i));
+			return 0;
+		}
+		total += part_blen + (i > 0 ? sep_blen : 0);
+		if (total > (duk_size_t) DUK_HSTRING_MAX_BYTELEN) {
+			/* Generic path throws. */
+			return 0;
+		}
+	}
+
+	/* The buffer allocation may have side effects so re-validate the
+	 * array and bounds check every copy.
+	 */
+	buf = (duk_uint8_t *) duk_push_fixed_buffer_nozero(thr, total);
+	p = buf;
+	p_end = buf + total;
+	tv_base = duk__arraypart_get_dense_range(thr, h, 0, len);
+	if (tv_base == NULL) {
+		goto fail;
+	}
+	sep_data = duk_hstring_get_data_and_bytelen(duk_known_hstring(thr, 0), &sep_blen);
+	for (i = 0; i < len; i++) {
+		if (!duk__array_join_get_part(thr, tv_base + i, numbuf, &part_data, &part_blen)) {
+			goto fail;
+		}
+		if (i > 0) {
+			if ((duk_size_t) (p_end - p) < sep_blen) {
+				goto fail;
+			}
+			duk_memcpy_unsafe((void *) p, (const void *) sep_data, sep_blen);
+			p += sep_blen;
+		}
+		if ((duk_size_t) (p_end - p) < part_blen) {
+			goto fail;
+		}
+		duk_memcpy_unsafe((void *) p, (const void *) part_data, part_blen);
+		p += part_blen;
+	}
+	if (p != p_end) {
+		goto fail;
+	}
+
+	/* Unpaired surrogates at join points are combined by the intern
+	 * WTF-8 sanitization, like in duk_join().
+	 */
+	(void) duk_buffer_to_string(thr, -1);
+
+	/* [ sep ToObject(this) len res ] */
+	return 1;
+
+fail:
+	DUK_D(DUK_DPRINT("array modified during join fast path, fall back to slow path"));
+	duk_pop_unsafe(thr);
+	return 0;
+}
+#endif /* DUK_USE_ARRAY_FASTPATH */
+
 DUK_INTERNAL duk_ret_t duk_bi_array_prototype_join_shared(duk_hthread *thr) {
 	duk_uint32_t len, count;
 	duk_uint32_t idx;
@@ -385,6 +603,12 @@ DUK_INTERNAL duk_ret_t duk_bi_array_prototype_join_shared(duk_hthread *thr) {
 	                     (duk_tval *) duk_get_tval(thr, 1),
 	                     (unsigned long) len));
 
+#if defined(DUK_USE_ARRAY_FASTPATH)
+	if (!to_locale_string && duk__array_join_fastpath(thr, len)) {
+		return 1;
+	}
+#endif
+
 	/* The extra (+4) is tight. */
 	valstack_required = (duk_idx_t) ((len >= DUK__ARRAY_MID_JOIN_LIMIT ? DUK__ARRAY_MID_JOIN_LIMIT : len) + 4);
 	duk_require_stack(thr, valstack_required);
@@ -941,6 +1165,88 @@ DUK_INTERNAL duk_ret_t duk_bi_array_prototype_sort(duk_hthread *thr) {
  *   unshift is (close to?) <--> splice(0, 0, [items])?
  */
 
+#if defined(DUK_USE_ARRAY_FASTPATH)
+DUK_LOCAL duk_harray *duk__array_splice_fastpath_this(duk_hthread *thr, duk_uint32_t len, duk_uint32_t new_len) {
+	duk_harray *h_arr;
+
+	h_arr = duk__arraypart_fastpath_this(thr);
+	/* Moving elements may fill gaps, i.e. create new own properties, so
+	 * the array must be extensible even when it doesn't grow.
+	 */
+	if (h_arr == NULL || h_arr->length != len || DUK_HARRAY_LENGTH_NONWRITABLE(h_arr) ||
+	    !DUK_HOBJECT_HAS_EXTENSIBLE((duk_hobject *) h_arr)) {
+		return NULL;
+	}
+	if (new_len > len && new_len > DUK_HOBJECT_GET_ASIZE((duk_hobject *) h_arr)) {
+		return NULL;
+	}
+	return h_arr;
+}
+
+/* Dense array splice() using the array part directly: deleted elements
+ * are moved into the result array and the tail is moved with a single
+ * memmove.  Called after argument coercion (which may have side effects)
+ * so the fast path conditions are checked here.  Returns 1 with the result
+ * array pushed if handled, 0 if the slow path must be used.
+ */
+DUK_LOCAL duk_bool_t duk__array_splice_fastpath(duk_hthread *thr,
+                                                duk_uint32_t len,
+                                                duk_uint32_t act_start,
+                                                duk_uint32_t del_count,
+                                                duk_uint32_t item_count) {
+	duk_harray *h_arr;
+	duk_tval *tv_arraypart;
+	duk_tval *tv_res;
+	duk_tval *tv_src;
+	duk_tval *tv_dst;
+	duk_uint32_t new_len;
+	duk_uint32_t i;
+
+	DUK_ASSERT(act_start <= len);
+	DUK_ASSERT(del_count <= len - act_start);
+
+	new_len = len - del_count + item_count;
+	if (duk__array_splice_fastpath_this(thr, len, new_len) == NULL) {
+		return 0;
+	}
+
+	/* The result array allocation may trigger a GC which may run
+	 * finalizers or compact the array part, so recheck.
+	 */
+	tv_res = duk_push_harray_with_size_outptr(thr, del_count);
+	h_arr = duk__array_splice_fastpath_this(thr, len, new_len);
+	if (h_arr == NULL) {
+		duk_pop_unsafe(thr);
+		return 0;
+	}
+
+	/* No net refcount change for the moves; array part entries above
+	 * 'length' are unused and gaps move along as 'unused'.
+	 */
+	tv_arraypart = DUK_HOBJECT_A_GET_BASE(thr->heap, (duk_hobject *) h_arr);
+	duk_memcpy_unsafe((void *) tv_res, (const void *) (tv_arraypart + act_start), (size_t) del_count * sizeof(duk_tval));
+	duk_memmove_unsafe((void *) (tv_arraypart + act_start + item_count),
+	                   (const void *) (tv_arraypart + act_start + del_count),
+	                   (size_t) (len - act_start - del_count) * sizeof(duk_tval));
+	for (i = new_len; i < len; i++) {
+		DUK_TVAL_SET_UNUSED(tv_arraypart + i);
+	}
+
+	/* Items remain on the value stack too, so INCREF. */
+	tv_src = thr->valstack_bottom + 2; /* args start at index 2 */
+	tv_dst = tv_arraypart + act_start;
+	for (i = 0; i < item_count; i++) {
+		DUK_TVAL_SET_TVAL(tv_dst, tv_src);
+		DUK_TVAL_INCREF(thr, tv_dst);
+		tv_src++;
+		tv_dst++;
+	}
+	h_arr->length = new_len;
+
+	return 1;
+}
+#endif /* DUK_USE_ARRAY_FASTPATH */
+
 DUK_INTERNAL duk_ret_t duk_bi_array_prototype_splice(duk_hthread *thr) {
 	duk_idx_t nargs;
 	duk_uint32_t len_u32;
@@ -1002,6 +1308,17 @@ DUK_INTERNAL duk_ret_t duk_bi_array_prototype_splice(duk_hthread *thr) {
 		DUK_DCERROR_RANGE_INVALID_LENGTH(thr);
 	}
 
+#if defined(DUK_USE_ARRAY_FASTPATH)
+	if (duk__array_splice_fastpath(thr,
+	                               (duk_uint32_t) len,
+	                               (duk_uint32_t) act_start,
+	                               (duk_uint32_t) del_count,
+	                               (duk_uint32_t) item_count)) {
+		DUK_ASSERT_TOP(thr, nargs + 3);
+		return 1;
+	}
+#endif
+
 	duk_push_array(thr);
 
 	/* stack[0] = start
@@ -1113,10 +1430,39 @@ DUK_INTERNAL duk_ret_t duk_bi_array_prototype_reverse(duk_hthread *thr) {
 	duk_uint32_t middle;
 	duk_uint32_t lower, upper;
 	duk_bool_t have_lower, have_upper;
+#if defined(DUK_USE_ARRAY_FASTPATH)
+	duk_harray *h_arr;
+#endif
 
 	len = duk__push_this_obj_len_u32(thr);
 	middle = len / 2;
 
+#if defined(DUK_USE_ARRAY_FASTPATH)
+	/* Dense arrays without gaps are reversed in place by swapping the
+	 * array part values; net refcount changes are zero and there are
+	 * no side effects.
+	 */
+	h_arr = duk__arraypart_fastpath_this(thr);
+	if (h_arr != NULL && h_arr->length == len &&
+	    duk__arraypart_get_dense_range(thr, (duk_hobject *) h_arr, 0, len) != NULL) {
+		duk_tval *tv_lower;
+		duk_tval *tv_upper;
+		duk_tval tv_tmp;
+
+		tv_lower = DUK_HOBJECT_A_GET_BASE(thr->heap, (duk_hobject *) h_arr);
+		tv_upper = tv_lower + len - 1;
+		while (tv_lower < tv_upper) {
+			DUK_TVAL_SET_TVAL(&tv_tmp, tv_lower);
+			DUK_TVAL_SET_TVAL(tv_lower, tv_upper);
+			DUK_TVAL_SET_TVAL(tv_upper, &tv_tmp);
+			tv_lower++;
+			tv_upper--;
+		}
+		duk_pop_unsafe(thr); /* -> [ ToObject(this) ] */
+		return 1;
+	}
+#endif
+
 	/* If len <= 1, middle will be 0 and for-loop bails out
 	 * immediately (0 < 0 -> false).
 	 */
@@ -1201,10 +1547,36 @@ DUK_INTERNAL duk_ret_t duk_bi_array_prototype_slice(duk_hthread *thr) {
 	DUK_ASSERT(start >= 0 && start <= len);
 	DUK_ASSERT(end >= 0 && end <= len);
 
+#if defined(DUK_USE_ARRAY_FASTPATH)
+	/* Dense source range: copy values directly into a preallocated
+	 * result array part.  The range is checked again after the result
+	 * allocation because its side effects may have modified the source.
+	 */
+	if (start < end &&
+	    duk__arraypart_get_dense_range(thr, duk_get_hobject(thr, 2), (duk_uint32_t) start, (duk_uint32_t) end) != NULL) {
+		duk_tval *tv_src;
+		duk_tval *tv_dst;
+
+		tv_dst = duk_push_harray_with_size_outptr(thr, (duk_uint32_t) (end - start));
+		tv_src = duk__arraypart_get_dense_range(thr, duk_get_hobject(thr, 2), (duk_uint32_t) start, (duk_uint32_t) end);
+		if (tv_src != NULL) {
+			for (i = start; i < end; i++) {
+				DUK_TVAL_SET_TVAL(tv_dst, tv_src + i);
+				DUK_TVAL_INCREF(thr, tv_dst);
+				tv_dst++;
+			}
+			duk_replace(thr, 4);
+			DUK_ASSERT_TOP(thr, 5);
+			return 1;
+		}
+		duk_pop_unsafe(thr);
+	}
+#endif
+
 	idx = 0;
 	for (i = start; i < end; i++) {
 		DUK_ASSERT_TOP(thr, 5);
-		if (duk_get_prop_index(thr, 2, (duk_uarridx_t) i)) {
+		if (duk__get_prop_index_fast(thr, 2, (duk_uarridx_t) i)) {
 			duk_xdef_prop_index_wec(thr, 4, idx);
 			res_length = idx + 1;
 		} else {
@@ -1225,9 +1597,71 @@ DUK_INTERNAL duk_ret_t duk_bi_array_prototype_slice(duk_hthread *thr) {
  *  shift()
  */
 
+#if defined(DUK_USE_ARRAY_FASTPATH)
+DUK_LOCAL duk_ret_t duk__array_shift_fastpath(duk_hthread *thr, duk_harray *h_arr) {
+	duk_tval *tv_arraypart;
+	duk_uint32_t len;
+
+	/* Moving elements down may fill gaps (new own properties) so the
+	 * array must also be extensible.
+	 */
+	if (DUK_HARRAY_LENGTH_NONWRITABLE(h_arr) || !DUK_HOBJECT_HAS_EXTENSIBLE((duk_hobject *) h_arr)) {
+		return 0; /* slow path */
+	}
+
+	tv_arraypart = DUK_HOBJECT_A_GET_BASE(thr->heap, (duk_hobject *) h_arr);
+	len = h_arr->length;
+	DUK_ASSERT_VS_SPACE(thr);
+	if (len == 0) {
+		/* nop, return undefined */
+		DUK_ASSERT(DUK_TVAL_IS_UNDEFINED(thr->valstack_top));
+		thr->valstack_top++;
+		return 1;
+	}
+
+	/* Like pop(), no check for an index property inherited from
+	 * Array.prototype, and gaps are returned as undefined.
+	 */
+	if (DUK_TVAL_IS_UNUSED(tv_arraypart)) {
+		DUK_ASSERT(DUK_TVAL_IS_UNDEFINED(thr->valstack_top));
+	} else {
+		/* No net refcount change. */
+		DUK_TVAL_SET_TVAL(thr->valstack_top, tv_arraypart);
+	}
+	thr->valstack_top++;
+
+	/* Move the remaining elements down with a single memmove, again
+	 * with no net refcount change.  Gaps move along as 'unused' which
+	 * matches the standard algorithm deleting the target index.
+	 */
+	len--;
+	duk_memmove_unsafe((void *) tv_arraypart, (const void *) (tv_arraypart + 1), (size_t) len * sizeof(duk_tval));
+	DUK_TVAL_SET_UNUSED(tv_arraypart + len);
+	h_arr->length = len;
+
+	return 1;
+}
+#endif /* DUK_USE_ARRAY_FASTPATH */
+
 DUK_INTERNAL duk_ret_t duk_bi_array_prototype_shift(duk_hthread *thr) {
 	duk_uint32_t len;
 	duk_uint32_t i;
+#if defined(DUK_USE_ARRAY_FASTPATH)
+	duk_harray *h_arr;
+#endif
+
+	DUK_ASSERT_TOP(thr, 0);
+
+#if defined(DUK_USE_ARRAY_FASTPATH)
+	h_arr = duk__arraypart_fastpath_this(thr);
+	if (h_arr) {
+		duk_ret_t rc;
+		rc = duk__array_shift_fastpath(thr, h_arr);
+		if (rc != 0) {
+			return rc;
+		}
+	}
+#endif
 
 	len = duk__push_this_obj_len_u32(thr);
 	if (len == 0) {
@@ -1267,10 +1701,70 @@ DUK_INTERNAL duk_ret_t duk_bi_array_prototype_shift(duk_hthread *thr) {
  *  unshift()
  */
 
+#if defined(DUK_USE_ARRAY_FASTPATH)
+DUK_LOCAL duk_ret_t duk__array_unshift_fastpath(duk_hthread *thr, duk_harray *h_arr) {
+	duk_tval *tv_arraypart;
+	duk_tval *tv_src;
+	duk_tval *tv_dst;
+	duk_uint32_t len;
+	duk_idx_t i, n;
+
+	len = h_arr->length;
+	n = (duk_idx_t) (thr->valstack_top - thr->valstack_bottom);
+	DUK_ASSERT(n >= 0);
+
+	if (DUK_HARRAY_LENGTH_NONWRITABLE(h_arr) || !DUK_HOBJECT_HAS_EXTENSIBLE((duk_hobject *) h_arr) ||
+	    len + (duk_uint32_t) n < len || len + (duk_uint32_t) n > DUK_HOBJECT_GET_ASIZE((duk_hobject *) h_arr)) {
+		/* Array part would need to be extended, or a special case.
+		 * The slow path grows the array part with spare so that
+		 * further calls can use the fast path again.
+		 */
+		return 0;
+	}
+
+	/* Make room at the front with a single memmove and copy the
+	 * arguments in; no net refcount change.  Array part entries
+	 * above 'length' are unused so nothing is overwritten.
+	 */
+	tv_arraypart = DUK_HOBJECT_A_GET_BASE(thr->heap, (duk_hobject *) h_arr);
+	duk_memmove_unsafe((void *) (tv_arraypart + n), (const void *) tv_arraypart, (size_t) len * sizeof(duk_tval));
+
+	tv_src = thr->valstack_bottom;
+	tv_dst = tv_arraypart;
+	for (i = 0; i < n; i++) {
+		DUK_TVAL_SET_TVAL(tv_dst, tv_src);
+		DUK_TVAL_SET_UNDEFINED(tv_src);
+		tv_src++;
+		tv_dst++;
+	}
+	thr->valstack_top = thr->valstack_bottom;
+	len += (duk_uint32_t) n;
+	h_arr->length = len;
+
+	duk_push_u32(thr, len);
+	return 1;
+}
+#endif /* DUK_USE_ARRAY_FASTPATH */
+
 DUK_INTERNAL duk_ret_t duk_bi_array_prototype_unshift(duk_hthread *thr) {
 	duk_idx_t nargs;
 	duk_uint32_t len;
 	duk_uint32_t i;
+#if defined(DUK_USE_ARRAY_FASTPATH)
+	duk_harray *h_arr;
+#endif
+
+#if defined(DUK_USE_ARRAY_FASTPATH)
+	h_arr = duk__arraypart_fastpath_this(thr);
+	if (h_arr) {
+		duk_ret_t rc;
+		rc = duk__array_unshift_fastpath(thr, h_arr);
+		if (rc != 0) {
+			return rc;
+		}
+		DUK_DD(DUK_DDPRINT("array unshift() fast path exited, resize case"));
+	}
+#endif
 
 	nargs = duk_get_top(thr);
 	len = duk__push_this_obj_len_u32(thr);
@@ -1339,6 +1833,9 @@ DUK_INTERNAL duk_ret_t duk_bi_array_prototype_indexof_shared(duk_hthread *thr) {
 	duk_idx_t nargs;
 	duk_int_t i, len;
 	duk_int_t from_idx;
+#if defined(DUK_USE_ARRAY_FASTPATH)
+	duk_hobject *h;
+#endif
 	duk_small_int_t idx_step = duk_get_current_magic(thr); /* idx_step is +1 for indexOf, -1 for lastIndexOf */
 
 	/* lastIndexOf() needs to be a vararg function because we must distinguish
@@ -1399,9 +1896,30 @@ DUK_INTERNAL duk_ret_t duk_bi_array_prototype_indexof_shared(duk_hthread *thr) {
 	 * stack[3] = length (not needed, but not popped above)
 	 */
 
+#if defined(DUK_USE_ARRAY_FASTPATH)
+	h = duk_get_hobject(thr, 2);
+#endif
 	for (i = from_idx; i >= 0 && i < len; i += idx_step) {
+#if defined(DUK_USE_ARRAY_FASTPATH)
+		duk_tval *tv;
+#endif
+
 		DUK_ASSERT_TOP(thr, 4);
 
+#if defined(DUK_USE_ARRAY_FASTPATH)
+		/* Present array part elements are compared in place; strict
+		 * equality has no side effects so nothing needs to be pushed.
+		 */
+		tv = duk__arraypart_get_tval(thr, h, (duk_uint32_t) i);
+		if (tv != NULL) {
+			if (duk_js_strict_equals(DUK_GET_TVAL_POSIDX(thr, 0), tv)) {
+				duk_push_int(thr, i);
+				return 1;
+			}
+			continue;
+		}
+#endif
+
 		if (duk_get_prop_index(thr, 2, (duk_uarridx_t) i)) {
 			DUK_ASSERT_TOP(thr, 5);
 			if (duk_strict_equals(thr, 0, 4)) {
@@ -1465,7 +1983,7 @@ DUK_INTERNAL duk_ret_t duk_bi_array_prototype_iter_shared(duk_hthread *thr) {
 	for (i = 0; i < len; i++) {
 		DUK_ASSERT_TOP(thr, 5);
 
-		if (!duk_get_prop_index(thr, 2, (duk_uarridx_t) i)) {
+		if (!duk__get_prop_index_fast(thr, 2, (duk_uarridx_t) i)) {
 			/* For 'map' trailing missing elements don't invoke the
 			 * callback but count towards the result length.
 			 */
@@ -1605,20 +2123,18 @@ DUK_INTERNAL duk_ret_t duk_bi_array_prototype_reduce_shared(duk_hthread *thr) {
 
 		DUK_ASSERT((have_acc && duk_get_top(thr) == 5) || (!have_acc && duk_get_top(thr) == 4));
 
-		if (!duk_has_prop_index(thr, 2, (duk_uarridx_t) i)) {
+		if (!duk__has_get_prop_index(thr, 2, (duk_uarridx_t) i)) {
 			continue;
 		}
 
 		if (!have_acc) {
-			DUK_ASSERT_TOP(thr, 4);
-			duk_get_prop_index(thr, 2, (duk_uarridx_t) i);
-			have_acc = 1;
 			DUK_ASSERT_TOP(thr, 5);
+			have_acc = 1;
 		} else {
-			DUK_ASSERT_TOP(thr, 5);
+			DUK_ASSERT_TOP(thr, 6);
 			duk_dup_0(thr);
 			duk_dup(thr, 4);
-			duk_get_prop_index(thr, 2, (duk_uarridx_t) i);
+			duk_dup(thr, 5);
 			duk_push_u32(thr, i);
 			duk_dup_2(thr);
 			DUK_DDD(DUK_DDDPRINT("calling reduce function: func=%!T, prev=%!T, curr=%!T, idx=%!T, obj=%!T",
@@ -1630,6 +2146,7 @@ DUK_INTERNAL duk_ret_t duk_bi_array_prototype_reduce_shared(duk_hthread *thr) {
 			duk_call(thr, 4);
 			DUK_DDD(DUK_DDDPRINT("-> result: %!T", (duk_tval *) duk_get_tval(thr, -1)));
 			duk_replace(thr, 4);
+			duk_pop_unsafe(thr);
 			DUK_ASSERT_TOP(thr, 5);
 		}
 	}
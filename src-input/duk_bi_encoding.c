@@ -11,11 +11,6 @@
  *  Data structures for encoding/decoding
  */
 
-typedef struct {
-	duk_uint8_t *out; /* where to write next byte(s) */
-	duk_codepoint_t lead; /* lead surrogate */
-} duk__encode_context;
-
 typedef struct {
 	/* UTF-8 decoding state */
 	duk_codepoint_t codepoint; /* built up incrementally */
@@ -158,60 +153,70 @@ DUK_LOCAL duk_codepoint_t duk__utf8_decode_next(duk__decode_context *dec_ctx, du
 }
 
 #if defined(DUK_USE_ENCODING_BUILTINS)
-DUK_LOCAL void duk__utf8_encode_char(void *udata, duk_codepoint_t codepoint) {
-	duk__encode_context *enc_ctx;
-
-	DUK_ASSERT(codepoint >= 0);
-	enc_ctx = (duk__encode_context *) udata;
-	DUK_ASSERT(enc_ctx != NULL);
-
-#if !defined(DUK_USE_PREFER_SIZE)
-	if (codepoint <= 0x7f && enc_ctx->lead == 0x0000L) {
-		/* Fast path for ASCII. */
-		*enc_ctx->out++ = (duk_uint8_t) codepoint;
-		return;
-	}
-#endif
-
-	if (DUK_UNLIKELY(codepoint > 0x10ffffL)) {
-		/* cannot legally encode in UTF-8 */
-		codepoint = DUK_UNICODE_CP_REPLACEMENT_CHARACTER;
-	} else if (codepoint >= 0xd800L && codepoint <= 0xdfffL) {
-		if (codepoint <= 0xdbffL) {
-			/* high surrogate */
-			duk_codepoint_t prev_lead = enc_ctx->lead;
-			enc_ctx->lead = codepoint;
-			if (prev_lead == 0x0000L) {
-				/* high surrogate, no output */
-				return;
-			} else {
-				/* consecutive high surrogates, consider first one unpaired */
-				codepoint = DUK_UNICODE_CP_REPLACEMENT_CHARACTER;
-			}
-		} else {
-			/* low surrogate */
-			if (enc_ctx->lead != 0x0000L) {
-				codepoint =
-				    (duk_codepoint_t) (0x010000L + ((enc_ctx->lead - 0xd800L) << 10) + (codepoint - 0xdc00L));
-				enc_ctx->lead = 0x0000L;
-			} else {
-				/* unpaired low surrogate */
-				DUK_ASSERT(enc_ctx->lead == 0x0000L);
-				codepoint = DUK_UNICODE_CP_REPLACEMENT_CHARACTER;
+/* Encode the string 'h_input' into UTF-8 at 'out' which has room for
+ * 'out_len' bytes.  String data is WTF-8 so the only change needed is to
+ * replace unpaired surrogates (ED A0-BF xx) with U+FFFD (EF BF BD), which
+ * has the same length; the full result is always exactly as long as the
+ * input.  Stops before a codepoint which doesn't fit.  Returns the number
+ * of bytes written and the number of UTF-16 code units consumed in
+ * '*out_read'.
+ */
+DUK_LOCAL duk_size_t duk__utf8_encode_wtf8(duk_hstring *h_input, duk_uint8_t *out, duk_size_t out_len, duk_size_t *out_read) {
+	const duk_uint8_t *p;
+	const duk_uint8_t *p_start;
+	const duk_uint8_t *p_end;
+	duk_uint8_t *q;
+	duk_uint8_t *q_end;
+	duk_size_t n_read;
+
+	DUK_ASSERT(h_input != NULL);
+	DUK_ASSERT(!DUK_HSTRING_HAS_SYMBOL(h_input));
+	DUK_ASSERT(out != NULL || out_len == 0U);
+	DUK_ASSERT(out_read != NULL);
+
+	p_start = duk_hstring_get_data(h_input);
+	p_end = p_start + duk_hstring_get_bytelen(h_input);
+	DUK_ASSERT(duk_unicode_is_valid_wtf8(p_start, (duk_size_t) (p_end - p_start)));
+	p = p_start;
+	q = out;
+	q_end = out + out_len;
+	n_read = 0;
+
+	while (p < p_end) {
+		duk_uint8_t t;
+		duk_small_uint_t clen;
+
+		t = *p;
+		if (DUK_LIKELY(t < 0x80U)) {
+			if (DUK_UNLIKELY(q == q_end)) {
+				break;
 			}
+			*q++ = t;
+			p++;
+			n_read++;
+			continue;
 		}
-	} else {
-		if (enc_ctx->lead != 0x0000L) {
-			/* unpaired high surrogate: emit replacement character and the input codepoint */
-			enc_ctx->lead = 0x0000L;
-			enc_ctx->out = duk__utf8_emit_repl(enc_ctx->out);
+
+		clen = (t < 0xe0U ? 2U : (t < 0xf0U ? 3U : 4U));
+		DUK_ASSERT((duk_size_t) (p_end - p) >= clen);
+		if ((duk_size_t) (q_end - q) < clen) {
+			break;
 		}
+		if (clen == 3U && t == 0xedU && p[1] >= 0xa0U) {
+			/* Unpaired surrogate; valid pairs are always combined
+			 * into a 4-byte sequence in WTF-8.
+			 */
+			q = duk__utf8_emit_repl(q);
+		} else {
+			duk_memcpy((void *) q, (const void *) p, (size_t) clen);
+			q += clen;
+		}
+		p += clen;
+		n_read += (clen == 4U ? 2U : 1U); /* non-BMP is a surrogate pair in UTF-16 */
 	}
 
-	/* Codepoint may be original input, a decoded surrogate pair, or may
-	 * have been replaced with U+FFFD.
-	 */
-	enc_ctx->out += duk_unicode_encode_xutf8((duk_ucodepoint_t) codepoint, enc_ctx->out);
+	*out_read = n_read;
+	return (duk_size_t) (q - out);
 }
 #endif /* DUK_USE_ENCODING_BUILTINS */
 
@@ -256,6 +261,36 @@ DUK_LOCAL duk_ret_t duk__decode_helper(duk_hthread *thr, duk__decode_context *de
 		}
 	}
 
+#if !defined(DUK_USE_PREFER_SIZE)
+	/* Fast path for a pure ASCII chunk with no partial sequence pending:
+	 * the result is the input as is, so intern it directly without an
+	 * intermediate output buffer.  Interning is safe against finalizer
+	 * side effects on the input buffer.
+	 */
+	if (dec_ctx->needed == 0) {
+		const duk_uint8_t *p;
+		const duk_uint8_t *p_end;
+
+		input = (const duk_uint8_t *) duk_get_buffer_data(thr, 0, &len_tmp);
+		DUK_ASSERT(input != NULL || len_tmp == 0);
+		p = input;
+		p_end = input + len_tmp;
+		while (p != p_end && *p < 0x80U) {
+			p++;
+		}
+		if (p == p_end) {
+			if (len_tmp > 0) {
+				dec_ctx->bom_handled = 1; /* ASCII is never a BOM */
+			}
+			if (!stream) {
+				duk__utf8_decode_init(dec_ctx);
+			}
+			duk_push_lstring(thr, (const char *) input, len_tmp);
+			return 1;
+		}
+	}
+#endif
+
 	/* Allowance is 3*len in the general case because all bytes may potentially
 	 * become U+FFFD.  If the first byte completes a non-BMP codepoint it will
 	 * decode to a CESU-8 surrogate pair (6 bytes) so we allow 3 extra bytes to
@@ -292,6 +327,21 @@ DUK_LOCAL duk_ret_t duk__decode_helper(duk_hthread *thr, duk__decode_context *de
 	in = input;
 	out = output;
 	while (in < input + len) {
+#if !defined(DUK_USE_PREFER_SIZE)
+		if (dec_ctx->needed == 0 && *in < 0x80U) {
+			/* ASCII run with no partial sequence pending: copy as is. */
+			const duk_uint8_t *run = in;
+
+			do {
+				in++;
+			} while (in < input + len && *in < 0x80U);
+			duk_memcpy((void *) out, (const void *) run, (size_t) (in - run));
+			out += in - run;
+			dec_ctx->bom_handled = 1;
+			continue;
+		}
+#endif
+
 		codepoint = duk__utf8_decode_next(dec_ctx, *in++);
 		if (codepoint < 0) {
 			if (codepoint == DUK__CP_CONTINUE) {
@@ -368,88 +418,69 @@ DUK_INTERNAL duk_ret_t duk_bi_textencoder_prototype_encoding_getter(duk_hthread
 }
 
 DUK_INTERNAL duk_ret_t duk_bi_textencoder_prototype_encode(duk_hthread *thr) {
-	duk__encode_context enc_ctx;
 	duk_size_t len;
-	duk_size_t final_len;
+	duk_size_t n_read;
+	duk_size_t n_written;
 	duk_uint8_t *output;
 
 	DUK_ASSERT_TOP(thr, 1);
 	if (duk_is_undefined(thr, 0)) {
-		len = 0;
-	} else {
-		duk_hstring *h_input;
-
-		h_input = duk_to_hstring(thr, 0);
-		DUK_ASSERT(h_input != NULL);
-
-		len = (duk_size_t) duk_hstring_get_charlen(h_input);
-		if (len >= DUK_HBUFFER_MAX_BYTELEN / 3) {
-			DUK_ERROR_TYPE(thr, DUK_STR_RESULT_TOO_LONG);
-			DUK_WO_NORETURN(return 0;);
-		}
+		duk_push_hstring_empty(thr);
+		duk_replace(thr, 0);
 	}
+	(void) duk_to_hstring(thr, 0);
 
-	/* Allowance is 3*len because all bytes can potentially be replaced with
-	 * U+FFFD -- which rather inconveniently encodes to 3 bytes in UTF-8.
-	 * Rely on dynamic buffer data pointer stability: no other code has
-	 * access to the data pointer.
-	 *
-	 * XXX: The buffer allocation strategy used here is rather inefficient.
-	 * Maybe switch to a chunk-based strategy, or preprocess the string to
-	 * figure out the space needed ahead of time?
+	/* UTF-8 output is exactly as long as the WTF-8 input, so the result
+	 * can be allocated at its final size.
 	 */
-	DUK_ASSERT(3 * len >= len);
-	output = (duk_uint8_t *) duk_push_dynamic_buffer(thr, 3 * len);
-
-	if (len > 0) {
-		DUK_ASSERT(duk_is_string(thr, 0)); /* True if len > 0. */
-
-		/* XXX: duk_decode_string() is used to process the input
-		 * string.  For standard ECMAScript strings, represented
-		 * internally as CESU-8, this is fine.  However, behavior
-		 * beyond CESU-8 is not very strict: codepoints using an
-		 * extended form of UTF-8 are also accepted, and invalid
-		 * codepoint sequences (which are allowed in Duktape strings)
-		 * are not handled as well as they could (e.g. invalid
-		 * continuation bytes may mask following codepoints).
-		 * This is how ECMAScript code would also see such strings.
-		 * Maybe replace duk_decode_string() with an explicit strict
-		 * CESU-8 decoder here?
-		 */
-		enc_ctx.lead = 0x0000L;
-		enc_ctx.out = output;
-		duk_decode_string(thr, 0, duk__utf8_encode_char, (void *) &enc_ctx);
-		if (enc_ctx.lead != 0x0000L) {
-			/* unpaired high surrogate at end of string */
-			enc_ctx.out = duk__utf8_emit_repl(enc_ctx.out);
-			DUK_ASSERT(enc_ctx.out <= output + (3 * len));
-		}
-
-		/* The output buffer is usually very much oversized, so shrink it to
-		 * actually needed size.  Pointer stability assumed up to this point.
-		 */
-		DUK_ASSERT_TOP(thr, 2);
-		DUK_ASSERT(output == (duk_uint8_t *) duk_get_buffer_data(thr, -1, NULL));
-
-		final_len = (duk_size_t) (enc_ctx.out - output);
-		duk_resize_buffer(thr, -1, final_len);
-		/* 'output' and 'enc_ctx.out' are potentially invalidated by the resize. */
-	} else {
-		final_len = 0;
+	len = (duk_size_t) duk_hstring_get_bytelen(duk_known_hstring(thr, 0));
+	if (len > DUK_HBUFFER_MAX_BYTELEN) {
+		DUK_ERROR_TYPE(thr, DUK_STR_RESULT_TOO_LONG);
+		DUK_WO_NORETURN(return 0;);
 	}
+	output = (duk_uint8_t *) duk_push_fixed_buffer_nozero(thr, len);
+	n_written = duk__utf8_encode_wtf8(duk_known_hstring(thr, 0), output, len, &n_read);
+	DUK_ASSERT(n_written == len);
+	DUK_UNREF(n_written);
 
 	/* Standard WHATWG output is a Uint8Array.  Here the Uint8Array will
-	 * be backed by a dynamic buffer which differs from e.g. Uint8Arrays
-	 * created as 'new Uint8Array(N)'.  ECMAScript code won't see the
-	 * difference but C code will.  When bufferobjects are not supported,
-	 * returns a plain dynamic buffer.
+	 * be backed by a fixed buffer like Uint8Arrays created as
+	 * 'new Uint8Array(N)'.  When bufferobjects are not supported, returns
+	 * a plain fixed buffer.
 	 */
 #if defined(DUK_USE_BUFFEROBJECT_SUPPORT)
-	duk_push_buffer_object(thr, -1, 0, final_len, DUK_BUFOBJ_UINT8ARRAY);
+	duk_push_buffer_object(thr, -1, 0, len, DUK_BUFOBJ_UINT8ARRAY);
 #endif
 	return 1;
 }
 
+DUK_INTERNAL duk_ret_t duk_bi_textencoder_prototype_encode_into(duk_hthread *thr) {
+	duk_uint8_t *output;
+	duk_size_t out_len;
+	duk_size_t n_read;
+	duk_size_t n_written;
+
+	DUK_ASSERT_TOP(thr, 2);
+
+	/* Coerce the source first: it may have side effects which could
+	 * affect the destination buffer.  After that, no side effects are
+	 * possible until the output has been written.  The destination is
+	 * any buffer value, with a Uint8Array being the standard case.
+	 */
+	(void) duk_to_hstring(thr, 0);
+	output = (duk_uint8_t *) duk_require_buffer_data(thr, 1, &out_len);
+	DUK_ASSERT(output != NULL || out_len == 0U);
+
+	n_written = duk__utf8_encode_wtf8(duk_known_hstring(thr, 0), output, out_len, &n_read);
+
+	duk_push_object(thr);
+	duk_push_number(thr, (duk_double_t) n_read);
+	duk_put_prop_literal(thr, -2, "read");
+	duk_push_number(thr, (duk_double_t) n_written);
+	duk_put_prop_literal(thr, -2, "written");
+	return 1;
+}
+
 DUK_INTERNAL duk_ret_t duk_bi_textdecoder_constructor(duk_hthread *thr) {
 	duk__decode_context *dec_ctx;
 	duk_bool_t fatal = 0;
@@ -8,11 +8,6 @@
  *  Encoding/decoding helpers
  */
 
-/* XXX: Could add fast path (for each transform callback) with direct byte
- * lookups (no shifting) and no explicit check for x < 0x80 before table
- * lookup.
- */
-
 /* Macros for creating and checking bitmasks for character encoding.
  * Bit number is a bit counterintuitive, but minimizes code size.
  */
@@ -68,6 +63,18 @@ DUK_LOCAL const duk_uint8_t duk__decode_uri_component_reserved_table[16] = {
 	DUK__MKBITS(0, 0, 0, 0, 0, 0, 0, 0), DUK__MKBITS(0, 0, 0, 0, 0, 0, 0, 0), /* 0x70-0x7f */
 };
 
+/* Bytes which decoding transforms pass through as is: ASCII except '%'. */
+DUK_LOCAL const duk_uint8_t duk__decode_passthrough_table[16] = {
+	DUK__MKBITS(1, 1, 1, 1, 1, 1, 1, 1), DUK__MKBITS(1, 1, 1, 1, 1, 1, 1, 1), /* 0x00-0x0f */
+	DUK__MKBITS(1, 1, 1, 1, 1, 1, 1, 1), DUK__MKBITS(1, 1, 1, 1, 1, 1, 1, 1), /* 0x10-0x1f */
+	DUK__MKBITS(1, 1, 1, 1, 1, 0, 1, 1), DUK__MKBITS(1, 1, 1, 1, 1, 1, 1, 1), /* 0x20-0x2f */
+	DUK__MKBITS(1, 1, 1, 1, 1, 1, 1, 1), DUK__MKBITS(1, 1, 1, 1, 1, 1, 1, 1), /* 0x30-0x3f */
+	DUK__MKBITS(1, 1, 1, 1, 1, 1, 1, 1), DUK__MKBITS(1, 1, 1, 1, 1, 1, 1, 1), /* 0x40-0x4f */
+	DUK__MKBITS(1, 1, 1, 1, 1, 1, 1, 1), DUK__MKBITS(1, 1, 1, 1, 1, 1, 1, 1), /* 0x50-0x5f */
+	DUK__MKBITS(1, 1, 1, 1, 1, 1, 1, 1), DUK__MKBITS(1, 1, 1, 1, 1, 1, 1, 1), /* 0x60-0x6f */
+	DUK__MKBITS(1, 1, 1, 1, 1, 1, 1, 1), DUK__MKBITS(1, 1, 1, 1, 1, 1, 1, 1), /* 0x70-0x7f */
+};
+
 #if defined(DUK_USE_SECTION_B)
 /* E5.1 Section B.2.2, step 7. */
 DUK_LOCAL const duk_uint8_t duk__escape_unescaped_table[16] = {
@@ -111,11 +118,26 @@ DUK_LOCAL duk_small_int_t duk__decode_hex_escape(const duk_uint8_t *p, duk_small
 	return t;
 }
 
-DUK_LOCAL int duk__transform_helper(duk_hthread *thr, duk__transform_callback callback, const void *udata) {
+/* Transform the string at index 0.  Runs of ASCII bytes marked in
+ * 'passthrough_table' are output as is and only other codepoints go through
+ * the callback.  Each other input byte is assumed to produce at most
+ * 'max_expand' output bytes (3 for '%xx' escaping, 1 for decoding) so that a
+ * pre-pass can size the output buffer; the callbacks still ensure space so
+ * this is only a hint.
+ */
+DUK_LOCAL int duk__transform_helper(duk_hthread *thr,
+                                    duk__transform_callback callback,
+                                    const void *udata,
+                                    const duk_uint8_t *passthrough_table,
+                                    duk_small_uint_t max_expand) {
 	duk__transform_context tfm_ctx_alloc;
 	duk__transform_context *tfm_ctx = &tfm_ctx_alloc;
 	duk_codepoint_t cp;
 	duk_size_t input_blen;
+	duk_size_t other_count;
+	duk_size_t output_guess;
+	const duk_uint8_t *p;
+	const duk_uint8_t *q;
 
 	tfm_ctx->thr = thr;
 
@@ -123,13 +145,42 @@ DUK_LOCAL int duk__transform_helper(duk_hthread *thr, duk__transform_callback ca
 	DUK_ASSERT(tfm_ctx->h_str != NULL);
 
 	input_blen = duk_hstring_get_bytelen(tfm_ctx->h_str);
-	DUK_BW_INIT_PUSHBUF(thr, &tfm_ctx->bw, input_blen); /* initial size guess */
-
 	tfm_ctx->p_start = duk_hstring_get_data(tfm_ctx->h_str);
 	tfm_ctx->p_end = tfm_ctx->p_start + input_blen;
-	tfm_ctx->p = tfm_ctx->p_start;
 
+	/* Pre-pass: if everything passes through, the input string is the
+	 * result.  Otherwise size the output buffer for the worst case.
+	 */
+	other_count = 0;
+	for (p = tfm_ctx->p_start; p < tfm_ctx->p_end; p++) {
+		if (!(*p < 0x80U && DUK__CHECK_BITMASK(passthrough_table, *p))) {
+			other_count++;
+		}
+	}
+	if (other_count == 0) {
+		duk_dup_0(thr);
+		return 1;
+	}
+	output_guess = input_blen + other_count * (duk_size_t) (max_expand - 1U);
+	if (output_guess < input_blen || output_guess > (duk_size_t) DUK_HSTRING_MAX_BYTELEN) {
+		/* Result would be too long (or wrapped); let the writes fail. */
+		output_guess = input_blen;
+	}
+	DUK_BW_INIT_PUSHBUF(thr, &tfm_ctx->bw, output_guess);
+
+	tfm_ctx->p = tfm_ctx->p_start;
 	while (tfm_ctx->p < tfm_ctx->p_end) {
+		p = tfm_ctx->p;
+		q = p;
+		while (q < tfm_ctx->p_end && *q < 0x80U && DUK__CHECK_BITMASK(passthrough_table, *q)) {
+			q++;
+		}
+		if (q != p) {
+			DUK_BW_WRITE_ENSURE_BYTES(thr, &tfm_ctx->bw, p, (duk_size_t) (q - p));
+			tfm_ctx->p = q;
+			continue;
+		}
+
 		cp = (duk_codepoint_t) duk_unicode_decode_xutf8_checked(thr, &tfm_ctx->p, tfm_ctx->p_start, tfm_ctx->p_end);
 		callback(tfm_ctx, udata, cp);
 	}
@@ -686,32 +737,44 @@ DUK_INTERNAL duk_ret_t duk_bi_global_object_is_finite(duk_hthread *thr) {
 
 #if defined(DUK_USE_GLOBAL_BUILTIN)
 DUK_INTERNAL duk_ret_t duk_bi_global_object_decode_uri(duk_hthread *thr) {
-	return duk__transform_helper(thr, duk__transform_callback_decode_uri, (const void *) duk__decode_uri_reserved_table);
+	return duk__transform_helper(thr,
+	                             duk__transform_callback_decode_uri,
+	                             (const void *) duk__decode_uri_reserved_table,
+	                             duk__decode_passthrough_table,
+	                             1);
 }
 
 DUK_INTERNAL duk_ret_t duk_bi_global_object_decode_uri_component(duk_hthread *thr) {
 	return duk__transform_helper(thr,
 	                             duk__transform_callback_decode_uri,
-	                             (const void *) duk__decode_uri_component_reserved_table);
+	                             (const void *) duk__decode_uri_component_reserved_table,
+	                             duk__decode_passthrough_table,
+	                             1);
 }
 
 DUK_INTERNAL duk_ret_t duk_bi_global_object_encode_uri(duk_hthread *thr) {
-	return duk__transform_helper(thr, duk__transform_callback_encode_uri, (const void *) duk__encode_uriunescaped_table);
+	return duk__transform_helper(thr,
+	                             duk__transform_callback_encode_uri,
+	                             (const void *) duk__encode_uriunescaped_table,
+	                             duk__encode_uriunescaped_table,
+	                             3);
 }
 
 DUK_INTERNAL duk_ret_t duk_bi_global_object_encode_uri_component(duk_hthread *thr) {
 	return duk__transform_helper(thr,
 	                             duk__transform_callback_encode_uri,
-	                             (const void *) duk__encode_uricomponent_unescaped_table);
+	                             (const void *) duk__encode_uricomponent_unescaped_table,
+	                             duk__encode_uricomponent_unescaped_table,
+	                             3);
 }
 
 #if defined(DUK_USE_SECTION_B)
 DUK_INTERNAL duk_ret_t duk_bi_global_object_escape(duk_hthread *thr) {
-	return duk__transform_helper(thr, duk__transform_callback_escape, (const void *) NULL);
+	return duk__transform_helper(thr, duk__transform_callback_escape, (const void *) NULL, duk__escape_unescaped_table, 3);
 }
 
 DUK_INTERNAL duk_ret_t duk_bi_global_object_unescape(duk_hthread *thr) {
-	return duk__transform_helper(thr, duk__transform_callback_unescape, (const void *) NULL);
+	return duk__transform_helper(thr, duk__transform_callback_unescape, (const void *) NULL, duk__decode_passthrough_table, 1);
 }
 #endif /* DUK_USE_SECTION_B */
 #endif /* DUK_USE_GLOBAL_BUILTIN */
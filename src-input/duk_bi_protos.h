@@ -74,6 +74,25 @@ void duk_bi_json_stringify_helper(duk_hthread *thr,
 
 DUK_INTERNAL_DECL duk_ret_t duk_textdecoder_decode_utf8_nodejs(duk_hthread *thr);
 
+#if defined(DUK_USE_NATIVE_ACCESSOR_FASTPATH)
+/* Accessors called directly by property code, referenced even when the
+ * built-in data omits them.
+ */
+DUK_INTERNAL_DECL duk_ret_t duk_bi_native_function_length(duk_hthread *thr);
+DUK_INTERNAL_DECL duk_ret_t duk_bi_native_function_name(duk_hthread *thr);
+DUK_INTERNAL_DECL duk_ret_t duk_bi_error_prototype_stack_getter(duk_hthread *thr);
+DUK_INTERNAL_DECL duk_ret_t duk_bi_error_prototype_filename_getter(duk_hthread *thr);
+DUK_INTERNAL_DECL duk_ret_t duk_bi_error_prototype_linenumber_getter(duk_hthread *thr);
+DUK_INTERNAL_DECL duk_ret_t duk_bi_error_prototype_stack_setter(duk_hthread *thr);
+DUK_INTERNAL_DECL duk_ret_t duk_bi_error_prototype_filename_setter(duk_hthread *thr);
+DUK_INTERNAL_DECL duk_ret_t duk_bi_error_prototype_linenumber_setter(duk_hthread *thr);
+DUK_INTERNAL_DECL duk_ret_t duk_bi_typedarray_byteoffset_getter(duk_hthread *thr);
+DUK_INTERNAL_DECL duk_ret_t duk_bi_typedarray_bytelength_getter(duk_hthread *thr);
+#if defined(DUK_USE_BUFFEROBJECT_SUPPORT)
+DUK_INTERNAL_DECL duk_ret_t duk_bi_typedarray_buffer_getter(duk_hthread *thr);
+#endif
+#endif /* DUK_USE_NATIVE_ACCESSOR_FASTPATH */
+
 #if defined(DUK_USE_ES6_PROXY)
 DUK_INTERNAL_DECL void duk_proxy_ownkeys_postprocess(duk_hthread *thr, duk_hobject *h_proxy_target, duk_uint_t flags);
 #endif
@@ -47,6 +47,7 @@ struct duk_catcher;
 struct duk_ljstate;
 struct duk_strcache_entry;
 struct duk_litcache_entry;
+struct duk_protocache_entry;
 struct duk_strtab_entry;
 
 #if defined(DUK_USE_DEBUG)
@@ -108,6 +109,7 @@ typedef struct duk_catcher duk_catcher;
 typedef struct duk_ljstate duk_ljstate;
 typedef struct duk_strcache_entry duk_strcache_entry;
 typedef struct duk_litcache_entry duk_litcache_entry;
+typedef struct duk_protocache_entry duk_protocache_entry;
 typedef struct duk_strtab_entry duk_strtab_entry;
 
 #if defined(DUK_USE_DEBUG)
@@ -102,12 +102,12 @@
 
 #define DUK_HBUFFER_FIXED_GET_DATA_PTR(heap, x) ((duk_uint8_t *) (((duk_hbuffer_fixed *) (void *) (x)) + 1))
 
-#if defined(DUK_USE_HEAPPTR16)
+#if defined(DUK_HEAPPTR_COMPRESSED)
 #define DUK_HBUFFER_DYNAMIC_GET_DATA_PTR(heap, x) \
-	((void *) DUK_USE_HEAPPTR_DEC16((heap)->heap_udata, ((duk_heaphdr *) (x))->h_extra16))
+	((void *) DUK_HEAPPTR_DEC((heap)->heap_udata, ((duk_heaphdr *) (x))->h_extra16))
 #define DUK_HBUFFER_DYNAMIC_SET_DATA_PTR(heap, x, v) \
 	do { \
-		((duk_heaphdr *) (x))->h_extra16 = DUK_USE_HEAPPTR_ENC16((heap)->heap_udata, (void *) (v)); \
+		((duk_heaphdr *) (x))->h_extra16 = DUK_HEAPPTR_ENC((heap)->heap_udata, (void *) (v)); \
 	} while (0)
 #define DUK_HBUFFER_DYNAMIC_SET_DATA_PTR_NULL(heap, x) \
 	do { \
@@ -128,7 +128,7 @@
 /* No pointer compression because pointer is potentially outside of
  * Duktape heap.
  */
-#if defined(DUK_USE_HEAPPTR16)
+#if defined(DUK_HEAPPTR_COMPRESSED)
 #define DUK_HBUFFER_EXTERNAL_GET_DATA_PTR(heap, x) ((void *) (x)->curr_alloc)
 #define DUK_HBUFFER_EXTERNAL_SET_DATA_PTR(heap, x, v) \
 	do { \
@@ -153,7 +153,7 @@
 /* Get a pointer to the current buffer contents (matching current allocation
  * size).  May be NULL for zero size dynamic/external buffer.
  */
-#if defined(DUK_USE_HEAPPTR16)
+#if defined(DUK_HEAPPTR_COMPRESSED)
 #define DUK_HBUFFER_GET_DATA_PTR(heap, x) \
 	(DUK_HBUFFER_HAS_DYNAMIC((x)) ? \
              (DUK_HBUFFER_HAS_EXTERNAL((x)) ? DUK_HBUFFER_EXTERNAL_GET_DATA_PTR((heap), (duk_hbuffer_external *) (x)) : \
@@ -298,7 +298,7 @@ struct duk_hbuffer_dynamic {
 	duk_size_t size;
 #endif
 
-#if defined(DUK_USE_HEAPPTR16)
+#if defined(DUK_HEAPPTR_COMPRESSED)
 	/* Stored in duk_heaphdr h_extra16. */
 #else
 	void *curr_alloc; /* may be NULL if alloc_size == 0 */
@@ -58,7 +58,7 @@ DUK_INTERNAL duk_hbuffer *duk_hbuffer_alloc(duk_heap *heap, duk_size_t size, duk
 		DUK_UNREF(h);
 		*out_bufdata = NULL;
 #if defined(DUK_USE_EXPLICIT_NULL_INIT)
-#if defined(DUK_USE_HEAPPTR16)
+#if defined(DUK_HEAPPTR_COMPRESSED)
 /* the compressed pointer is zeroed which maps to NULL, so nothing to do. */
 #else
 		DUK_HBUFFER_EXTERNAL_SET_DATA_PTR(heap, h, NULL);
@@ -87,7 +87,7 @@ DUK_INTERNAL duk_hbuffer *duk_hbuffer_alloc(duk_heap *heap, duk_size_t size, duk
 		} else {
 			*out_bufdata = NULL;
 #if defined(DUK_USE_EXPLICIT_NULL_INIT)
-#if defined(DUK_USE_HEAPPTR16)
+#if defined(DUK_HEAPPTR_COMPRESSED)
 /* the compressed pointer is zeroed which maps to NULL, so nothing to do. */
 #else
 			DUK_HBUFFER_DYNAMIC_SET_DATA_PTR(heap, h, NULL);
@@ -14,31 +14,31 @@
 
 /* XXX: casts could be improved, especially for GET/SET DATA */
 
-#if defined(DUK_USE_HEAPPTR16)
-#define DUK_HCOMPFUNC_GET_DATA(heap, h) ((duk_hbuffer_fixed *) (void *) DUK_USE_HEAPPTR_DEC16((heap)->heap_udata, (h)->data16))
+#if defined(DUK_HEAPPTR_COMPRESSED)
+#define DUK_HCOMPFUNC_GET_DATA(heap, h) ((duk_hbuffer_fixed *) (void *) DUK_HEAPPTR_DEC((heap)->heap_udata, (h)->data16))
 #define DUK_HCOMPFUNC_SET_DATA(heap, h, v) \
 	do { \
-		(h)->data16 = DUK_USE_HEAPPTR_ENC16((heap)->heap_udata, (void *) (v)); \
+		(h)->data16 = DUK_HEAPPTR_ENC((heap)->heap_udata, (void *) (v)); \
 	} while (0)
-#define DUK_HCOMPFUNC_GET_FUNCS(heap, h) ((duk_hobject **) (void *) (DUK_USE_HEAPPTR_DEC16((heap)->heap_udata, (h)->funcs16)))
+#define DUK_HCOMPFUNC_GET_FUNCS(heap, h) ((duk_hobject **) (void *) (DUK_HEAPPTR_DEC((heap)->heap_udata, (h)->funcs16)))
 #define DUK_HCOMPFUNC_SET_FUNCS(heap, h, v) \
 	do { \
-		(h)->funcs16 = DUK_USE_HEAPPTR_ENC16((heap)->heap_udata, (void *) (v)); \
+		(h)->funcs16 = DUK_HEAPPTR_ENC((heap)->heap_udata, (void *) (v)); \
 	} while (0)
-#define DUK_HCOMPFUNC_GET_BYTECODE(heap, h) ((duk_instr_t *) (void *) (DUK_USE_HEAPPTR_DEC16((heap)->heap_udata, (h)->bytecode16)))
+#define DUK_HCOMPFUNC_GET_BYTECODE(heap, h) ((duk_instr_t *) (void *) (DUK_HEAPPTR_DEC((heap)->heap_udata, (h)->bytecode16)))
 #define DUK_HCOMPFUNC_SET_BYTECODE(heap, h, v) \
 	do { \
-		(h)->bytecode16 = DUK_USE_HEAPPTR_ENC16((heap)->heap_udata, (void *) (v)); \
+		(h)->bytecode16 = DUK_HEAPPTR_ENC((heap)->heap_udata, (void *) (v)); \
 	} while (0)
-#define DUK_HCOMPFUNC_GET_LEXENV(heap, h) ((duk_hobject *) (void *) (DUK_USE_HEAPPTR_DEC16((heap)->heap_udata, (h)->lex_env16)))
+#define DUK_HCOMPFUNC_GET_LEXENV(heap, h) ((duk_hobject *) (void *) (DUK_HEAPPTR_DEC((heap)->heap_udata, (h)->lex_env16)))
 #define DUK_HCOMPFUNC_SET_LEXENV(heap, h, v) \
 	do { \
-		(h)->lex_env16 = DUK_USE_HEAPPTR_ENC16((heap)->heap_udata, (void *) (v)); \
+		(h)->lex_env16 = DUK_HEAPPTR_ENC((heap)->heap_udata, (void *) (v)); \
 	} while (0)
-#define DUK_HCOMPFUNC_GET_VARENV(heap, h) ((duk_hobject *) (void *) (DUK_USE_HEAPPTR_DEC16((heap)->heap_udata, (h)->var_env16)))
+#define DUK_HCOMPFUNC_GET_VARENV(heap, h) ((duk_hobject *) (void *) (DUK_HEAPPTR_DEC((heap)->heap_udata, (h)->var_env16)))
 #define DUK_HCOMPFUNC_SET_VARENV(heap, h, v) \
 	do { \
-		(h)->var_env16 = DUK_USE_HEAPPTR_ENC16((heap)->heap_udata, (void *) (v)); \
+		(h)->var_env16 = DUK_HEAPPTR_ENC((heap)->heap_udata, (void *) (v)); \
 	} while (0)
 #else
 #define DUK_HCOMPFUNC_GET_DATA(heap, h) ((duk_hbuffer_fixed *) (void *) (h)->data)
@@ -154,8 +154,8 @@ struct duk_hcompfunc {
 	 */
 
 	/* Data area, fixed allocation, stable data ptrs. */
-#if defined(DUK_USE_HEAPPTR16)
-	duk_uint16_t data16;
+#if defined(DUK_HEAPPTR_COMPRESSED)
+	duk_heapptr_t data16;
 #else
 	duk_hbuffer *data;
 #endif
@@ -167,9 +167,9 @@ struct duk_hcompfunc {
 	 * inner function pointers are not compressed, so that 'bytecode' will
 	 * also be 4-byte aligned.
 	 */
-#if defined(DUK_USE_HEAPPTR16)
-	duk_uint16_t funcs16;
-	duk_uint16_t bytecode16;
+#if defined(DUK_HEAPPTR_COMPRESSED)
+	duk_heapptr_t funcs16;
+	duk_heapptr_t bytecode16;
 #else
 	duk_hobject **funcs;
 	duk_instr_t *bytecode;
@@ -178,9 +178,9 @@ struct duk_hcompfunc {
 	/* Lexenv: lexical environment of closure, NULL for templates.
 	 * Varenv: variable environment of closure, NULL for templates.
 	 */
-#if defined(DUK_USE_HEAPPTR16)
-	duk_uint16_t lex_env16;
-	duk_uint16_t var_env16;
+#if defined(DUK_HEAPPTR_COMPRESSED)
+	duk_heapptr_t lex_env16;
+	duk_heapptr_t var_env16;
 #else
 	duk_hobject *lex_env;
 	duk_hobject *var_env;
@@ -115,6 +115,35 @@
 	} while (0)
 #endif
 
+/*
+ *  Budgeted refzero processing
+ */
+
+/* True if refzero_list is being processed right now somewhere in the C
+ * call stack, i.e. the list is non-empty and not suspended.
+ */
+#if defined(DUK_USE_REFZERO_BUDGET)
+#define DUK_HEAP_REFZERO_ACTIVE(heap) ((heap)->refzero_list != NULL && (heap)->refzero_curr == NULL)
+#else
+#define DUK_HEAP_REFZERO_ACTIVE(heap) ((heap)->refzero_list != NULL)
+#endif
+
+#if defined(DUK_USE_REFERENCE_COUNTING) && defined(DUK_USE_REFZERO_BUDGET)
+/* Free one slice of a suspended refzero cascade, if any.  Side effect free
+ * (no finalizers are executed) so this can be called from allocation paths.
+ */
+#define DUK_HEAP_REFZERO_SLICE(heap) \
+	do { \
+		if (DUK_UNLIKELY((heap)->refzero_curr != NULL)) { \
+			duk_heap_refzero_slice((heap)); \
+		} \
+	} while (0)
+#else
+#define DUK_HEAP_REFZERO_SLICE(heap) \
+	do { \
+	} while (0)
+#endif
+
 /*
  *  Other heap related defines
  */
@@ -175,8 +204,8 @@
 #if defined(DUK_USE_ROM_STRINGS)
 #define DUK_HEAP_GET_STRING(heap, idx) ((duk_hstring *) DUK_LOSE_CONST(duk_rom_strings_stridx[(idx)]))
 #else /* DUK_USE_ROM_STRINGS */
-#if defined(DUK_USE_HEAPPTR16)
-#define DUK_HEAP_GET_STRING(heap, idx) ((duk_hstring *) DUK_USE_HEAPPTR_DEC16((heap)->heap_udata, (heap)->strs16[(idx)]))
+#if defined(DUK_HEAPPTR_COMPRESSED)
+#define DUK_HEAP_GET_STRING(heap, idx) ((duk_hstring *) DUK_HEAPPTR_DEC((heap)->heap_udata, (heap)->strs16[(idx)]))
 #else
 #define DUK_HEAP_GET_STRING(heap, idx) ((heap)->strs[(idx)])
 #endif
@@ -337,6 +366,52 @@ struct duk_litcache_entry {
 	duk_hstring *h;
 };
 
+/*
+ *  Prototype chain lookup cache
+ */
+
+#if defined(DUK_USE_PROTOCACHE_SIZE)
+/* Number of bits in the set tracking objects and keys referenced by the
+ * prototype chain lookup cache.
+ */
+#define DUK_HEAP_PROTOCACHE_BITS (DUK_USE_PROTOCACHE_SIZE * 16)
+
+#define DUK_HEAP_PROTOCACHE_BIT_INDEX(ptr) \
+	((((duk_uint32_t) ((duk_uintptr_t) (ptr) >> 4)) ^ ((duk_uint32_t) ((duk_uintptr_t) (ptr) >> 16))) & \
+	 (DUK_HEAP_PROTOCACHE_BITS - 1U))
+
+/* Invalidate the cache if 'ptr' (a duk_hobject or duk_hstring) may be
+ * referenced by a cache entry.  Used when an object gets a property added
+ * or deleted, when its prototype changes, and when an object or a string
+ * is freed.
+ */
+#define DUK_HEAP_PROTOCACHE_CHECK(heap, ptr) \
+	do { \
+		duk_uint32_t duk__bitidx = DUK_HEAP_PROTOCACHE_BIT_INDEX((ptr)); \
+		if (DUK_UNLIKELY((heap)->protocache_bits[duk__bitidx >> 5] & ((duk_uint32_t) 1U << (duk__bitidx & 0x1fU)))) { \
+			duk_heap_protocache_invalidate((heap)); \
+		} \
+	} while (0)
+
+/* Record that 'ptr' may be referenced by a cache entry. */
+#define DUK_HEAP_PROTOCACHE_MARK(heap, ptr) \
+	do { \
+		duk_uint32_t duk__bitidx = DUK_HEAP_PROTOCACHE_BIT_INDEX((ptr)); \
+		(heap)->protocache_bits[duk__bitidx >> 5] |= (duk_uint32_t) 1U << (duk__bitidx & 0x1fU); \
+	} while (0)
+
+struct duk_protocache_entry {
+	duk_hobject *start; /* prototype the lookup continues from */
+	duk_hstring *key;
+	duk_hobject *holder; /* object holding 'key' on the chain, NULL if not found */
+	duk_uint32_t epoch; /* entry is valid if matches heap->protocache_epoch */
+};
+#else
+#define DUK_HEAP_PROTOCACHE_CHECK(heap, ptr) \
+	do { \
+	} while (0)
+#endif /* DUK_USE_PROTOCACHE_SIZE */
+
 /*
  *  Main heap structure
  */
@@ -383,10 +458,19 @@ struct duk_heap {
 	 * (or DECREF_NORZ) encounters a zero refcount.  Using a work list
 	 * allows fixed C stack size when refcounts go to zero for a chain of
 	 * objects.  Outside of DECREF this is always a NULL because DECREF is
-	 * processed without side effects (only memory free calls).
+	 * processed without side effects (only memory free calls), unless
+	 * DUK_USE_REFZERO_BUDGET is enabled: a large cascade is then freed in
+	 * bounded slices and refzero_list may remain non-NULL between slices.
 	 */
 #if defined(DUK_USE_REFERENCE_COUNTING)
 	duk_heaphdr *refzero_list;
+#if defined(DUK_USE_REFZERO_BUDGET)
+	/* Next refzero_list entry to free when a cascade has been suspended
+	 * because its budget ran out.  NULL if refzero_list is empty or is
+	 * being processed right now.
+	 */
+	duk_heaphdr *refzero_curr;
+#endif
 #endif
 
 #if defined(DUK_USE_FINALIZER_SUPPORT)
@@ -569,7 +653,7 @@ struct duk_heap {
 
 	/* String intern table (weak refs). */
 #if defined(DUK_USE_STRTAB_PTRCOMP)
-	duk_uint16_t *strtable16;
+	duk_heapptr_t *strtable16;
 #else
 	duk_hstring **strtable;
 #endif
@@ -593,12 +677,32 @@ struct duk_heap {
 	duk_litcache_entry litcache[DUK_USE_LITCACHE_SIZE];
 #endif
 
+#if defined(DUK_USE_INTCACHE_SIZE)
+	/* Integer string cache, indexed by the low bits of an array index
+	 * value.  Entries are weak references and are cleared when the
+	 * string is unlinked from the string table.
+	 */
+	duk_hstring *intcache[DUK_USE_INTCACHE_SIZE];
+#endif
+
+#if defined(DUK_USE_PROTOCACHE_SIZE)
+	/* Prototype chain lookup cache, maps (prototype, key) to the holder
+	 * object of an inherited property.  Entries are weak references;
+	 * objects and keys referenced by entries are tracked in a bit set
+	 * and any change to them invalidates all entries by bumping the
+	 * epoch.
+	 */
+	duk_protocache_entry protocache[DUK_USE_PROTOCACHE_SIZE];
+	duk_uint32_t protocache_bits[DUK_HEAP_PROTOCACHE_BITS / 32];
+	duk_uint32_t protocache_epoch;
+#endif
+
 	/* Built-in strings. */
 #if defined(DUK_USE_ROM_STRINGS)
 	/* No field needed when strings are in ROM. */
 #else
-#if defined(DUK_USE_HEAPPTR16)
-	duk_uint16_t strs16[DUK_HEAP_NUM_STRINGS];
+#if defined(DUK_HEAPPTR_COMPRESSED)
+	duk_heapptr_t strs16[DUK_HEAP_NUM_STRINGS];
 #else
 	duk_hstring *strs[DUK_HEAP_NUM_STRINGS];
 #endif
@@ -618,6 +722,10 @@ struct duk_heap {
 	duk_int_t stats_ms_try_count;
 	duk_int_t stats_ms_skip_count;
 	duk_int_t stats_ms_emergency_count;
+	duk_int_t stats_refzero_count;
+	duk_int_t stats_refzero_slices;
+	duk_int_t stats_refzero_suspend;
+	duk_int_t stats_refzero_max_slice;
 	duk_int_t stats_strtab_intern_hit;
 	duk_int_t stats_strtab_intern_miss;
 	duk_int_t stats_strtab_resize_check;
@@ -626,6 +734,11 @@ struct duk_heap {
 	duk_int_t stats_strtab_litcache_hit;
 	duk_int_t stats_strtab_litcache_miss;
 	duk_int_t stats_strtab_litcache_pin;
+	duk_int_t stats_strtab_intcache_hit;
+	duk_int_t stats_strtab_intcache_miss;
+	duk_int_t stats_protocache_hit;
+	duk_int_t stats_protocache_miss;
+	duk_int_t stats_protocache_invalidate;
 	duk_int_t stats_object_realloc_props;
 	duk_int_t stats_object_abandon_array;
 	duk_int_t stats_getownpropdesc_count;
@@ -709,6 +822,15 @@ DUK_INTERNAL void duk_heap_strtable_dump(duk_heap *heap);
 #endif
 
 DUK_INTERNAL_DECL void duk_heap_strcache_string_remove(duk_heap *heap, duk_hstring *h);
+
+#if defined(DUK_USE_PROTOCACHE_SIZE)
+DUK_INTERNAL_DECL duk_bool_t duk_heap_protocache_lookup(duk_heap *heap,
+                                                        duk_hobject *start,
+                                                        duk_hstring *key,
+                                                        duk_hobject **out_holder);
+DUK_INTERNAL_DECL void duk_heap_protocache_insert(duk_heap *heap, duk_hobject *start, duk_hstring *key, duk_hobject *holder);
+DUK_INTERNAL_DECL void duk_heap_protocache_invalidate(duk_heap *heap);
+#endif
 DUK_INTERNAL_DECL void duk_strcache_scan_char2byte_wtf8(duk_hthread *thr,
                                                         duk_hstring *h,
                                                         duk_uint32_t target_charoff,
@@ -738,6 +860,11 @@ DUK_INTERNAL_DECL void duk_heap_process_finalize_list(duk_heap *heap);
 
 DUK_INTERNAL_DECL void duk_heap_mark_and_sweep(duk_heap *heap, duk_small_uint_t flags);
 
+#if defined(DUK_USE_REFERENCE_COUNTING) && defined(DUK_USE_REFZERO_BUDGET)
+DUK_INTERNAL_DECL void duk_heap_refzero_slice(duk_heap *heap);
+DUK_INTERNAL_DECL void duk_heap_refzero_drain(duk_heap *heap);
+#endif
+
 DUK_INTERNAL_DECL duk_uint32_t duk_heap_hashstring(duk_heap *heap, const duk_uint8_t *str, duk_size_t len);
 
 #endif /* DUK_HEAP_H_INCLUDED */
@@ -22,6 +22,9 @@ DUK_INTERNAL void duk_free_hobject(duk_heap *heap, duk_hobject *h) {
 	DUK_ASSERT(heap != NULL);
 	DUK_ASSERT(h != NULL);
 
+	/* Address may be reused for another object. */
+	DUK_HEAP_PROTOCACHE_CHECK(heap, h);
+
 	DUK_FREE(heap, DUK_HOBJECT_GET_PROPS(heap, h));
 
 	if (DUK_HOBJECT_IS_COMPFUNC(h)) {
@@ -384,9 +387,13 @@ DUK_INTERNAL void duk_heap_free(duk_heap *heap) {
 	 * point beyond a DECREF (even a DECREF_NORZ).  Since Duktape 2.1
 	 * refzero_list processing is side effect free, so it is always
 	 * processed to completion by a DECREF initially triggering a zero
-	 * refcount.
+	 * refcount.  With DUK_USE_REFZERO_BUDGET a cascade may be suspended,
+	 * but mark-and-sweep drains it on entry; drain again to be safe.
 	 */
 #if defined(DUK_USE_REFERENCE_COUNTING)
+#if defined(DUK_USE_REFZERO_BUDGET)
+	duk_heap_refzero_drain(heap);
+#endif
 	DUK_ASSERT(heap->refzero_list == NULL); /* Always processed to completion inline. */
 #endif
 #if defined(DUK_USE_FINALIZER_SUPPORT)
@@ -515,8 +522,8 @@ DUK_LOCAL duk_bool_t duk__init_heap_strings(duk_heap *heap) {
 		 */
 		DUK_HSTRING_INCREF(_never_referenced_, h);
 
-#if defined(DUK_USE_HEAPPTR16)
-		heap->strs16[i] = DUK_USE_HEAPPTR_ENC16(heap->heap_udata, (void *) h);
+#if defined(DUK_HEAPPTR_COMPRESSED)
+		heap->strs16[i] = DUK_HEAPPTR_ENC(heap->heap_udata, (void *) h);
 #else
 		heap->strs[i] = h;
 #endif
@@ -542,7 +549,7 @@ DUK_LOCAL duk_bool_t duk__init_heap_thread(duk_heap *heap) {
 #if defined(DUK_USE_ROM_STRINGS)
 	/* No strs[] pointer. */
 #else /* DUK_USE_ROM_STRINGS */
-#if defined(DUK_USE_HEAPPTR16)
+#if defined(DUK_HEAPPTR_COMPRESSED)
 	thr->strs16 = heap->strs16;
 #else
 	thr->strs = heap->strs;
@@ -912,6 +919,9 @@ duk_heap *duk_heap_alloc(duk_alloc_function alloc_func,
 	res->heap_allocated = NULL;
 #if defined(DUK_USE_REFERENCE_COUNTING)
 	res->refzero_list = NULL;
+#if defined(DUK_USE_REFZERO_BUDGET)
+	res->refzero_curr = NULL;
+#endif
 #endif
 #if defined(DUK_USE_FINALIZER_SUPPORT)
 	res->finalize_list = NULL;
@@ -936,7 +946,7 @@ duk_heap *duk_heap_alloc(duk_alloc_function alloc_func,
 #if defined(DUK_USE_ROM_STRINGS)
 	/* no res->strs[] */
 #else /* DUK_USE_ROM_STRINGS */
-#if defined(DUK_USE_HEAPPTR16)
+#if defined(DUK_HEAPPTR_COMPRESSED)
 	/* res->strs16[] is zeroed and zero decodes to NULL, so no NULL inits. */
 #else
 	{
@@ -1019,7 +1029,7 @@ duk_heap *duk_heap_alloc(duk_alloc_function alloc_func,
 
 	st_initsize = DUK_USE_STRTAB_MINSIZE;
 #if defined(DUK_USE_STRTAB_PTRCOMP)
-	res->strtable16 = (duk_uint16_t *) alloc_func(heap_udata, sizeof(duk_uint16_t) * st_initsize);
+	res->strtable16 = (duk_heapptr_t *) alloc_func(heap_udata, sizeof(duk_heapptr_t) * st_initsize);
 	if (res->strtable16 == NULL) {
 		goto failed;
 	}
@@ -1037,7 +1047,7 @@ duk_heap *duk_heap_alloc(duk_alloc_function alloc_func,
 
 #if defined(DUK_USE_STRTAB_PTRCOMP)
 	/* zero assumption */
-	duk_memzero(res->strtable16, sizeof(duk_uint16_t) * st_initsize);
+	duk_memzero(res->strtable16, sizeof(duk_heapptr_t) * st_initsize);
 #else
 #if defined(DUK_USE_EXPLICIT_NULL_INIT)
 	{
@@ -1081,6 +1091,42 @@ duk_heap *duk_heap_alloc(duk_alloc_function alloc_func,
 #endif
 #endif /* DUK_USE_LITCACHE_SIZE */
 
+	/*
+	 *  Init intcache
+	 */
+#if defined(DUK_USE_INTCACHE_SIZE)
+	DUK_ASSERT(DUK_USE_INTCACHE_SIZE > 0);
+	DUK_ASSERT(DUK_IS_POWER_OF_TWO((duk_uint_t) DUK_USE_INTCACHE_SIZE));
+#if defined(DUK_USE_EXPLICIT_NULL_INIT)
+	{
+		duk_uint_t i;
+		for (i = 0; i < DUK_USE_INTCACHE_SIZE; i++) {
+			res->intcache[i] = NULL;
+		}
+	}
+#endif
+#endif /* DUK_USE_INTCACHE_SIZE */
+
+	/*
+	 *  Init protocache
+	 */
+#if defined(DUK_USE_PROTOCACHE_SIZE)
+	DUK_ASSERT(DUK_USE_PROTOCACHE_SIZE > 0);
+	DUK_ASSERT(DUK_IS_POWER_OF_TWO((duk_uint_t) DUK_USE_PROTOCACHE_SIZE));
+#if defined(DUK_USE_EXPLICIT_NULL_INIT)
+	{
+		duk_uint_t i;
+		for (i = 0; i < DUK_USE_PROTOCACHE_SIZE; i++) {
+			res->protocache[i].start = NULL;
+			res->protocache[i].key = NULL;
+			res->protocache[i].holder = NULL;
+		}
+	}
+#endif
+	/* Entry epoch 0 (zeroed above) is never valid. */
+	res->protocache_epoch = 1;
+#endif /* DUK_USE_PROTOCACHE_SIZE */
+
 	/* XXX: error handling is incomplete.  It would be cleanest if
 	 * there was a setjmp catchpoint, so that all init code could
 	 * freely throw errors.  If that were the case, the return code
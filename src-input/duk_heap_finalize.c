@@ -144,7 +144,7 @@ DUK_INTERNAL void duk_heap_process_finalize_list(duk_heap *heap) {
 	DUK_ASSERT(heap->heap_thread != NULL);
 	DUK_ASSERT(heap->heap_thread->valstack != NULL);
 #if defined(DUK_USE_REFERENCE_COUNTING)
-	DUK_ASSERT(heap->refzero_list == NULL);
+	DUK_ASSERT(!DUK_HEAP_REFZERO_ACTIVE(heap));
 #endif
 
 	DUK_ASSERT(heap->pf_prevent_count == 0);
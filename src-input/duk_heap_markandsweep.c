@@ -579,7 +579,7 @@ DUK_LOCAL void duk__sweep_stringtable(duk_heap *heap, duk_size_t *out_count_keep
 
 	for (i = 0; i < heap->st_size; i++) {
 #if defined(DUK_USE_STRTAB_PTRCOMP)
-		h = DUK_USE_HEAPPTR_DEC16(heap->heap_udata, heap->strtable16[i]);
+		h = DUK_HEAPPTR_DEC(heap->heap_udata, heap->strtable16[i]);
 #else
 		h = heap->strtable[i];
 #endif
@@ -973,7 +973,7 @@ DUK_LOCAL void duk__assert_walk_strtable(duk_heap *heap, duk__gc_hstring_assert
 		duk_hstring *h;
 
 #if defined(DUK_USE_STRTAB_PTRCOMP)
-		h = DUK_USE_HEAPPTR_DEC16(heap->heap_udata, heap->strtable16[i]);
+		h = DUK_HEAPPTR_DEC(heap->heap_udata, heap->strtable16[i]);
 #else
 		h = heap->strtable[i];
 #endif
@@ -1155,9 +1155,15 @@ DUK_LOCAL void duk__dump_stats(duk_heap *heap) {
 	                 (long) heap->stats_ms_try_count,
 	                 (long) heap->stats_ms_skip_count,
 	                 (long) heap->stats_ms_emergency_count));
+	DUK_D(DUK_DPRINT("stats refzero: count=%ld, slices=%ld, suspend=%ld, max_slice=%ld",
+	                 (long) heap->stats_refzero_count,
+	                 (long) heap->stats_refzero_slices,
+	                 (long) heap->stats_refzero_suspend,
+	                 (long) heap->stats_refzero_max_slice));
 	DUK_D(DUK_DPRINT("stats stringtable: intern_hit=%ld, intern_miss=%ld, "
 	                 "resize_check=%ld, resize_grow=%ld, resize_shrink=%ld, "
-	                 "litcache_hit=%ld, litcache_miss=%ld, litcache_pin=%ld",
+	                 "litcache_hit=%ld, litcache_miss=%ld, litcache_pin=%ld, "
+	                 "intcache_hit=%ld, intcache_miss=%ld",
 	                 (long) heap->stats_strtab_intern_hit,
 	                 (long) heap->stats_strtab_intern_miss,
 	                 (long) heap->stats_strtab_resize_check,
@@ -1165,7 +1171,13 @@ DUK_LOCAL void duk__dump_stats(duk_heap *heap) {
 	                 (long) heap->stats_strtab_resize_shrink,
 	                 (long) heap->stats_strtab_litcache_hit,
 	                 (long) heap->stats_strtab_litcache_miss,
-	                 (long) heap->stats_strtab_litcache_pin));
+	                 (long) heap->stats_strtab_litcache_pin,
+	                 (long) heap->stats_strtab_intcache_hit,
+	                 (long) heap->stats_strtab_intcache_miss));
+	DUK_D(DUK_DPRINT("stats protocache: hit=%ld, miss=%ld, invalidate=%ld",
+	                 (long) heap->stats_protocache_hit,
+	                 (long) heap->stats_protocache_miss,
+	                 (long) heap->stats_protocache_invalidate));
 	DUK_D(DUK_DPRINT("stats object: realloc_props=%ld, abandon_array=%ld",
 	                 (long) heap->stats_object_realloc_props,
 	                 (long) heap->stats_object_abandon_array));
@@ -1246,6 +1258,14 @@ DUK_INTERNAL void duk_heap_mark_and_sweep(duk_heap *heap, duk_small_uint_t flags
 	}
 	DUK_ASSERT(heap->ms_running == 0); /* ms_prevent_count is bumped when ms_running is set */
 
+#if defined(DUK_USE_REFERENCE_COUNTING) && defined(DUK_USE_REFZERO_BUDGET)
+	/* A suspended refzero cascade is not visible to mark-and-sweep
+	 * (objects are no longer in heap_allocated), so free it first.
+	 * This is side effect free.
+	 */
+	duk_heap_refzero_drain(heap);
+#endif
+
 	/* Heap_thread is used during mark-and-sweep for refcount finalization
 	 * (it's also used for finalizer execution once mark-and-sweep is
 	 * complete).  Heap allocation code ensures heap_thread is set and
@@ -87,6 +87,9 @@ DUK_INTERNAL DUK_INLINE_PERF DUK_HOT void *duk_heap_mem_alloc(duk_heap *heap, du
 	DUK_ASSERT(heap->alloc_func != NULL);
 	DUK_ASSERT_DISABLE(size >= 0);
 
+	/* Amortize a suspended refzero cascade over allocations (if enabled). */
+	DUK_HEAP_REFZERO_SLICE(heap);
+
 #if defined(DUK_USE_VOLUNTARY_GC)
 	/* Voluntary periodic GC (if enabled). */
 	if (DUK_UNLIKELY(--(heap)->ms_trigger_counter < 0)) {
@@ -0,0 +1,130 @@
+/*
+ *  Prototype chain lookup cache.
+ *
+ *  Maps a (prototype object, property key) pair into the object on the
+ *  prototype chain which holds the property as an own property, or to NULL
+ *  if no object on the chain has the property.  Property reads use the
+ *  cache after the own property lookup of the base object has failed, so
+ *  that e.g. a method defined several levels up a class hierarchy is found
+ *  with a single own property lookup on the holder.
+ *
+ *  Only the holder object is cached, not a property slot: the holder's own
+ *  property lookup is always repeated so that property table resizes and
+ *  compaction need no invalidation.  Only keys which are not array indices
+ *  and not 'length' are cached, so that own property lookups of the
+ *  objects on the chain involve only the entry part (no virtual properties,
+ *  no array part, no arguments object mapping).
+ *
+ *  Entries are weak references.  Every object on a cached chain (from the
+ *  start object to the holder) and the key are recorded in a bit set
+ *  indexed by a pointer hash.  When an object gets a property added or
+ *  deleted, has its prototype changed, or is freed, or when a string is
+ *  freed, DUK_HEAP_PROTOCACHE_CHECK() invalidates all entries if the
+ *  pointer's bit is set.  Invalidation bumps the epoch and clears the bit
+ *  set so it's cheap enough for the occasional false positive.
+ */
+
+#include "duk_internal.h"
+
+#if defined(DUK_USE_PROTOCACHE_SIZE)
+
+DUK_LOCAL DUK_ALWAYS_INLINE duk_protocache_entry *duk__protocache_get_entry(duk_heap *heap,
+                                                                           duk_hobject *start,
+                                                                           duk_hstring *key) {
+	duk_uint32_t idx;
+
+	idx = ((duk_uint32_t) ((duk_uintptr_t) start >> 4)) ^ duk_hstring_get_hash(key);
+	idx &= (duk_uint32_t) (DUK_USE_PROTOCACHE_SIZE - 1); /* Assumes size is power of 2. */
+	return heap->protocache + idx;
+}
+
+/* Look up (start, key); on a hit write the holder (NULL for not found) to
+ * 'out_holder' and return 1.
+ */
+DUK_INTERNAL duk_bool_t duk_heap_protocache_lookup(duk_heap *heap,
+                                                   duk_hobject *start,
+                                                   duk_hstring *key,
+                                                   duk_hobject **out_holder) {
+	duk_protocache_entry *e;
+
+	DUK_ASSERT(heap != NULL);
+	DUK_ASSERT(start != NULL);
+	DUK_ASSERT(key != NULL);
+	DUK_ASSERT(out_holder != NULL);
+
+	e = duk__protocache_get_entry(heap, start, key);
+	if (e->start == start && e->key == key && e->epoch == heap->protocache_epoch) {
+		DUK_STATS_INC(heap, stats_protocache_hit);
+		*out_holder = e->holder;
+		return 1;
+	}
+	DUK_STATS_INC(heap, stats_protocache_miss);
+	return 0;
+}
+
+/* Record that a lookup of 'key' starting from 'start' (inclusive) ends at
+ * 'holder', or at the end of the chain if 'holder' is NULL.  The caller
+ * must have marked the objects from 'start' up to 'holder' (or the end of
+ * the chain) using DUK_HEAP_PROTOCACHE_MARK() in the current epoch, either
+ * directly or via an earlier entry.
+ */
+DUK_INTERNAL void duk_heap_protocache_insert(duk_heap *heap, duk_hobject *start, duk_hstring *key, duk_hobject *holder) {
+	duk_protocache_entry *e;
+
+	DUK_ASSERT(heap != NULL);
+	DUK_ASSERT(start != NULL);
+	DUK_ASSERT(key != NULL);
+
+	DUK_DDD(DUK_DDDPRINT("protocache insert: start=%p, key=%!O, holder=%p", (void *) start, (duk_heaphdr *) key, (void *) holder));
+
+#if defined(DUK_USE_ASSERTIONS)
+	{
+		duk_hobject *curr;
+		duk_uint32_t bitidx;
+
+		for (curr = start;; curr = DUK_HOBJECT_GET_PROTOTYPE(heap, curr)) {
+			DUK_ASSERT(curr != NULL || holder == NULL);
+			if (curr == NULL) {
+				break;
+			}
+			bitidx = DUK_HEAP_PROTOCACHE_BIT_INDEX(curr);
+			DUK_ASSERT((heap->protocache_bits[bitidx >> 5] & ((duk_uint32_t) 1U << (bitidx & 0x1fU))) != 0U);
+			if (curr == holder) {
+				break;
+			}
+		}
+	}
+#endif
+
+	DUK_HEAP_PROTOCACHE_MARK(heap, key);
+
+	e = duk__protocache_get_entry(heap, start, key);
+	e->start = start;
+	e->key = key;
+	e->holder = holder;
+	e->epoch = heap->protocache_epoch;
+}
+
+/* Invalidate all entries.  Called via DUK_HEAP_PROTOCACHE_CHECK(). */
+DUK_INTERNAL void duk_heap_protocache_invalidate(duk_heap *heap) {
+	DUK_ASSERT(heap != NULL);
+
+	DUK_DDD(DUK_DDDPRINT("protocache invalidate, epoch %ld", (long) heap->protocache_epoch));
+	DUK_STATS_INC(heap, stats_protocache_invalidate);
+
+	heap->protocache_epoch++;
+	if (DUK_UNLIKELY(heap->protocache_epoch == 0)) {
+		/* Epoch wrapped: wipe entries so that no stale entry can
+		 * match a later epoch.  Entry epoch 0 is never valid.
+		 */
+		duk_uint_t i;
+
+		for (i = 0; i < DUK_USE_PROTOCACHE_SIZE; i++) {
+			heap->protocache[i].epoch = 0;
+		}
+		heap->protocache_epoch = 1;
+	}
+	duk_memzero((void *) heap->protocache_bits, sizeof(heap->protocache_bits));
+}
+
+#endif /* DUK_USE_PROTOCACHE_SIZE */
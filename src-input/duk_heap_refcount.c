@@ -276,23 +276,49 @@ DUK_INTERNAL void duk_heaphdr_refcount_finalize_norz(duk_heap *heap, duk_heaphdr
  *  we'll run pending finalizers but notice that we're already doing that and
  *  return.
  *
- *  This could be expanded to allow incremental freeing: just bail out
- *  early and resume at a future alloc/decref/refzero.  However, if that
- *  were done, the list structure would need to be kept consistent at all
- *  times, mark-and-sweep would need to handle refzero_list, etc.
+ *  With DUK_USE_REFZERO_BUDGET the cascade is freed incrementally: after
+ *  DUK_USE_REFZERO_BUDGET objects processing bails out early, leaving the
+ *  next object to free in heap->refzero_curr.  The 'prev' chain remains
+ *  consistent so processing resumes at a later refzero, allocation, or
+ *  executor interrupt.  Mark-and-sweep and heap destruction drain the list
+ *  fully before walking the heap.  While a slice is running refzero_curr
+ *  is NULL, which rejects recursive entry like refzero_list did above.
  */
 
+#if defined(DUK_USE_DEBUG)
+#define DUK__REFZERO_UPDATE_MAX_SLICE(heap, count) \
+	do { \
+		if ((count) > (heap)->stats_refzero_max_slice) { \
+			(heap)->stats_refzero_max_slice = (count); \
+		} \
+	} while (0)
+#else
+#define DUK__REFZERO_UPDATE_MAX_SLICE(heap, count) \
+	do { \
+	} while (0)
+#endif
+
 DUK_LOCAL void duk__refcount_free_pending(duk_heap *heap) {
 	duk_heaphdr *curr;
+#if defined(DUK_USE_REFZERO_BUDGET)
+	duk_int_t budget = DUK_USE_REFZERO_BUDGET;
+#endif
 #if defined(DUK_USE_DEBUG)
 	duk_int_t count = 0;
 #endif
 
 	DUK_ASSERT(heap != NULL);
 
+#if defined(DUK_USE_REFZERO_BUDGET)
+	curr = heap->refzero_curr;
+	DUK_ASSERT(curr != NULL);
+	heap->refzero_curr = NULL; /* Mark processing active. */
+	DUK_STATS_INC(heap, stats_refzero_slices);
+#else
 	curr = heap->refzero_list;
 	DUK_ASSERT(curr != NULL);
 	DUK_ASSERT(DUK_HEAPHDR_GET_PREV(heap, curr) == NULL); /* We're called on initial insert only. */
+#endif
 	/* curr->next is GARBAGE. */
 
 	do {
@@ -319,15 +345,54 @@ DUK_LOCAL void duk__refcount_free_pending(duk_heap *heap) {
 		/* prev->next is intentionally not updated and is garbage. */
 
 		duk_free_hobject(heap, (duk_hobject *) curr); /* Invalidates 'curr'. */
+		DUK_STATS_INC(heap, stats_refzero_count);
 
 		curr = prev;
+
+#if defined(DUK_USE_REFZERO_BUDGET)
+		if (DUK_UNLIKELY(--budget <= 0 && curr != NULL)) {
+			/* Budget exhausted, suspend.  Objects between 'curr'
+			 * and refzero_list are freed by a later slice.
+			 */
+			heap->refzero_curr = curr;
+			DUK_STATS_INC(heap, stats_refzero_suspend);
+			DUK__REFZERO_UPDATE_MAX_SLICE(heap, count);
+			DUK_DD(DUK_DDPRINT("refzero processed %ld objects, budget exhausted, suspend", (long) count));
+			return;
+		}
+#endif
 	} while (curr != NULL);
 
 	heap->refzero_list = NULL;
 
+	DUK__REFZERO_UPDATE_MAX_SLICE(heap, count);
 	DUK_DD(DUK_DDPRINT("refzero processed %ld objects", (long) count));
 }
 
+#if defined(DUK_USE_REFZERO_BUDGET)
+DUK_INTERNAL void duk_heap_refzero_slice(duk_heap *heap) {
+	DUK_ASSERT(heap != NULL);
+
+	/* No finalizers are run here: callers include the allocation path
+	 * which must remain side effect free.  Objects queued to
+	 * finalize_list are handled by the next refzero or refzero check.
+	 */
+	if (heap->refzero_curr == NULL || heap->ms_running != 0) {
+		return;
+	}
+	duk__refcount_free_pending(heap);
+}
+
+DUK_INTERNAL void duk_heap_refzero_drain(duk_heap *heap) {
+	DUK_ASSERT(heap != NULL);
+
+	while (heap->refzero_curr != NULL) {
+		duk__refcount_free_pending(heap);
+	}
+	DUK_ASSERT(heap->refzero_list == NULL);
+}
+#endif /* DUK_USE_REFZERO_BUDGET */
+
 DUK_LOCAL DUK_INLINE void duk__refcount_refzero_hobject(duk_heap *heap, duk_hobject *obj, duk_bool_t skip_free_pending) {
 	duk_heaphdr *hdr;
 	duk_heaphdr *root;
@@ -388,7 +453,7 @@ DUK_LOCAL DUK_INLINE void duk__refcount_refzero_hobject(duk_heap *heap, duk_hobj
 			 * call will run pending finalizers when refzero_list
 			 * is done.
 			 */
-			if (!skip_free_pending && heap->refzero_list == NULL) {
+			if (!skip_free_pending && !DUK_HEAP_REFZERO_ACTIVE(heap)) {
 				duk_heap_process_finalize_list(heap);
 			}
 			return;
@@ -411,8 +476,14 @@ DUK_LOCAL DUK_INLINE void duk__refcount_refzero_hobject(duk_heap *heap, duk_hobj
 		 * free calls, we can process it directly even when
 		 * NORZ macros are used: there are no side effects.
 		 */
+#if defined(DUK_USE_REFZERO_BUDGET)
+		DUK_ASSERT(heap->refzero_curr == NULL);
+		heap->refzero_curr = hdr;
+#endif
 		duk__refcount_free_pending(heap);
+#if !defined(DUK_USE_REFZERO_BUDGET)
 		DUK_ASSERT(heap->refzero_list == NULL);
+#endif
 
 		/* Process finalizers only after the entire cascade
 		 * is finished.  In most cases there's nothing to
@@ -431,6 +502,19 @@ DUK_LOCAL DUK_INLINE void duk__refcount_refzero_hobject(duk_heap *heap, duk_hobj
 		 * non-NULL, it's already being processed by someone
 		 * in the C call stack, so we're done.
 		 */
+#if defined(DUK_USE_REFZERO_BUDGET)
+		/* ... unless the cascade is suspended, in which case
+		 * new garbage pays for one slice of the backlog.
+		 */
+		if (heap->refzero_curr != NULL) {
+			duk__refcount_free_pending(heap);
+#if defined(DUK_USE_FINALIZER_SUPPORT)
+			if (!skip_free_pending && DUK_UNLIKELY(heap->finalize_list != NULL)) {
+				duk_heap_process_finalize_list(heap);
+			}
+#endif
+		}
+#endif
 	}
 }
 
@@ -438,7 +522,7 @@ DUK_LOCAL DUK_INLINE void duk__refcount_refzero_hobject(duk_heap *heap, duk_hobj
 DUK_INTERNAL DUK_ALWAYS_INLINE void duk_refzero_check_fast(duk_hthread *thr) {
 	DUK_ASSERT(thr != NULL);
 	DUK_ASSERT(thr->heap != NULL);
-	DUK_ASSERT(thr->heap->refzero_list == NULL); /* Processed to completion inline. */
+	DUK_ASSERT(!DUK_HEAP_REFZERO_ACTIVE(thr->heap)); /* Processed to completion (or suspended) inline. */
 
 	if (DUK_UNLIKELY(thr->heap->finalize_list != NULL)) {
 		duk_heap_process_finalize_list(thr->heap);
@@ -448,7 +532,7 @@ DUK_INTERNAL DUK_ALWAYS_INLINE void duk_refzero_check_fast(duk_hthread *thr) {
 DUK_INTERNAL void duk_refzero_check_slow(duk_hthread *thr) {
 	DUK_ASSERT(thr != NULL);
 	DUK_ASSERT(thr->heap != NULL);
-	DUK_ASSERT(thr->heap->refzero_list == NULL); /* Processed to completion inline. */
+	DUK_ASSERT(!DUK_HEAP_REFZERO_ACTIVE(thr->heap)); /* Processed to completion (or suspended) inline. */
 
 	if (DUK_UNLIKELY(thr->heap->finalize_list != NULL)) {
 		duk_heap_process_finalize_list(thr->heap);
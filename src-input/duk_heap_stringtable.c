@@ -13,8 +13,8 @@
 #endif
 
 #if defined(DUK_USE_STRTAB_PTRCOMP)
-#define DUK__HEAPPTR_ENC16(heap, ptr) DUK_USE_HEAPPTR_ENC16((heap)->heap_udata, (ptr))
-#define DUK__HEAPPTR_DEC16(heap, val) DUK_USE_HEAPPTR_DEC16((heap)->heap_udata, (val))
+#define DUK__HEAPPTR_ENC16(heap, ptr) DUK_HEAPPTR_ENC((heap)->heap_udata, (ptr))
+#define DUK__HEAPPTR_DEC16(heap, val) DUK_HEAPPTR_DEC((heap)->heap_udata, (val))
 #define DUK__GET_STRTABLE(heap)       ((heap)->strtable16)
 #else
 #define DUK__HEAPPTR_ENC16(heap, ptr) (ptr)
@@ -33,7 +33,7 @@
 #if defined(DUK_USE_DEBUG)
 DUK_INTERNAL void duk_heap_strtable_dump(duk_heap *heap) {
 #if defined(DUK_USE_STRTAB_PTRCOMP)
-	duk_uint16_t *strtable;
+	duk_heapptr_t *strtable;
 #else
 	duk_hstring **strtable;
 #endif
@@ -97,7 +97,7 @@ DUK_INTERNAL void duk_heap_strtable_dump(duk_heap *heap) {
 #if defined(DUK_USE_ASSERTIONS)
 DUK_LOCAL void duk__strtable_assert_checks(duk_heap *heap) {
 #if defined(DUK_USE_STRTAB_PTRCOMP)
-	duk_uint16_t *strtable;
+	duk_heapptr_t *strtable;
 #else
 	duk_hstring **strtable;
 #endif
@@ -279,8 +279,8 @@ DUK_LOCAL void duk__strtable_grow_inplace(duk_heap *heap) {
 	duk_hstring *next;
 	duk_hstring *prev;
 #if defined(DUK_USE_STRTAB_PTRCOMP)
-	duk_uint16_t *new_ptr;
-	duk_uint16_t *new_ptr_high;
+	duk_heapptr_t *new_ptr;
+	duk_heapptr_t *new_ptr_high;
 #else
 	duk_hstring **new_ptr;
 	duk_hstring **new_ptr_high;
@@ -307,7 +307,7 @@ DUK_LOCAL void duk__strtable_grow_inplace(duk_heap *heap) {
 	 */
 
 #if defined(DUK_USE_STRTAB_PTRCOMP)
-	new_ptr = (duk_uint16_t *) DUK_REALLOC(heap, heap->strtable16, sizeof(duk_uint16_t) * new_st_size);
+	new_ptr = (duk_heapptr_t *) DUK_REALLOC(heap, heap->strtable16, sizeof(duk_heapptr_t) * new_st_size);
 #else
 	new_ptr = (duk_hstring **) DUK_REALLOC(heap, heap->strtable, sizeof(duk_hstring *) * new_st_size);
 #endif
@@ -395,9 +395,9 @@ DUK_LOCAL void duk__strtable_shrink_inplace(duk_heap *heap) {
 	duk_hstring *other;
 	duk_hstring *root;
 #if defined(DUK_USE_STRTAB_PTRCOMP)
-	duk_uint16_t *old_ptr;
-	duk_uint16_t *old_ptr_high;
-	duk_uint16_t *new_ptr;
+	duk_heapptr_t *old_ptr;
+	duk_heapptr_t *old_ptr_high;
+	duk_heapptr_t *new_ptr;
 #else
 	duk_hstring **old_ptr;
 	duk_hstring **old_ptr_high;
@@ -454,7 +454,7 @@ DUK_LOCAL void duk__strtable_shrink_inplace(duk_heap *heap) {
 	 */
 
 #if defined(DUK_USE_STRTAB_PTRCOMP)
-	new_ptr = (duk_uint16_t *) DUK_REALLOC(heap, heap->strtable16, sizeof(duk_uint16_t) * new_st_size);
+	new_ptr = (duk_heapptr_t *) DUK_REALLOC(heap, heap->strtable16, sizeof(duk_heapptr_t) * new_st_size);
 	DUK_ASSERT(new_ptr != NULL);
 	heap->strtable16 = new_ptr;
 #else
@@ -568,7 +568,7 @@ DUK_LOCAL duk_hstring *duk__strtable_do_intern(duk_heap *heap, const duk_uint8_t
 	duk_hstring *res;
 	const duk_uint8_t *extdata;
 #if defined(DUK_USE_STRTAB_PTRCOMP)
-	duk_uint16_t *slot;
+	duk_heapptr_t *slot;
 #else
 	duk_hstring **slot;
 #endif
@@ -862,19 +862,42 @@ done:
 DUK_INTERNAL duk_hstring *duk_heap_strtable_intern_u32(duk_heap *heap, duk_uint32_t val) {
 	duk_uint8_t buf[DUK__STRTAB_U32_MAX_STRLEN];
 	duk_uint8_t *p;
+	duk_hstring *h;
+#if defined(DUK_USE_INTCACHE_SIZE)
+	duk_hstring **slot;
+#endif
 
 	DUK_ASSERT(heap != NULL);
 
+#if defined(DUK_USE_INTCACHE_SIZE)
+	/* Fast path check: value exists in the integer string cache.  Only
+	 * array index strings are cached so the arridx identifies the entry.
+	 */
+	slot = heap->intcache + (val & (DUK_USE_INTCACHE_SIZE - 1U));
+	h = *slot;
+	if (h != NULL && duk_hstring_get_arridx_fast_known(h) == val) {
+		DUK_STATS_INC(heap, stats_strtab_intcache_hit);
+		return h;
+	}
+	DUK_STATS_INC(heap, stats_strtab_intcache_miss);
+#endif
+
 	/* This is smaller and faster than a %lu sprintf. */
-	p = buf + sizeof(buf);
-	do {
-		p--;
-		*p = duk_lc_digits[val % 10];
-		val = val / 10;
-	} while (val != 0); /* For val == 0, emit exactly one '0'. */
+	p = duk_numconv_format_u32_backwards(buf + sizeof(buf), val);
 	DUK_ASSERT(p >= buf);
 
-	return duk_heap_strtable_intern(heap, (const duk_uint8_t *) p, (duk_uint32_t) ((buf + sizeof(buf)) - p));
+	h = duk_heap_strtable_intern(heap, (const duk_uint8_t *) p, (duk_uint32_t) ((buf + sizeof(buf)) - p));
+
+#if defined(DUK_USE_INTCACHE_SIZE)
+	/* The intern call may have run a GC which cleared the slot, so
+	 * the update must happen afterwards.  0xffffffff is not an array
+	 * index and is never cached.
+	 */
+	if (h != NULL && DUK_HSTRING_HAS_ARRIDX(h)) {
+		*slot = h;
+	}
+#endif
+	return h;
 }
 
 /*
@@ -977,14 +1000,30 @@ DUK_INTERNAL duk_hstring *duk_heap_strtable_intern_u32_checked(duk_hthread *thr,
  *  Remove (unlink) a string from the string table.
  *
  *  Just unlinks the duk_hstring, leaving link pointers as garbage.
- *  Caller must free the string itself.
+ *  Caller must free the string itself.  The integer string cache holds
+ *  weak references, so the string is also removed from the cache here.
+ *  The prototype chain lookup cache may use the string as a key, and is
+ *  invalidated if so.
  */
 
+#if defined(DUK_USE_INTCACHE_SIZE)
+DUK_LOCAL DUK_ALWAYS_INLINE void duk__strtable_intcache_remove(duk_heap *heap, duk_hstring *h) {
+	duk_hstring **slot;
+
+	if (DUK_HSTRING_HAS_ARRIDX(h)) {
+		slot = heap->intcache + (duk_hstring_get_arridx_fast_known(h) & (DUK_USE_INTCACHE_SIZE - 1U));
+		if (*slot == h) {
+			*slot = NULL;
+		}
+	}
+}
+#endif
+
 #if defined(DUK_USE_REFERENCE_COUNTING)
 /* Unlink without a 'prev' pointer. */
 DUK_INTERNAL void duk_heap_strtable_unlink(duk_heap *heap, duk_hstring *h) {
 #if defined(DUK_USE_STRTAB_PTRCOMP)
-	duk_uint16_t *slot;
+	duk_heapptr_t *slot;
 #else
 	duk_hstring **slot;
 #endif
@@ -1005,6 +1044,11 @@ DUK_INTERNAL void duk_heap_strtable_unlink(duk_heap *heap, duk_hstring *h) {
 	heap->st_count--;
 #endif
 
+#if defined(DUK_USE_INTCACHE_SIZE)
+	duk__strtable_intcache_remove(heap, h);
+#endif
+	DUK_HEAP_PROTOCACHE_CHECK(heap, h);
+
 #if defined(DUK_USE_STRTAB_PTRCOMP)
 	slot = heap->strtable16 + (duk_hstring_get_hash(h) & heap->st_mask);
 #else
@@ -1036,7 +1080,7 @@ DUK_INTERNAL void duk_heap_strtable_unlink(duk_heap *heap, duk_hstring *h) {
 /* Unlink with a 'prev' pointer. */
 DUK_INTERNAL void duk_heap_strtable_unlink_prev(duk_heap *heap, duk_hstring *h, duk_hstring *prev) {
 #if defined(DUK_USE_STRTAB_PTRCOMP)
-	duk_uint16_t *slot;
+	duk_heapptr_t *slot;
 #else
 	duk_hstring **slot;
 #endif
@@ -1057,6 +1101,11 @@ DUK_INTERNAL void duk_heap_strtable_unlink_prev(duk_heap *heap, duk_hstring *h,
 	heap->st_count--;
 #endif
 
+#if defined(DUK_USE_INTCACHE_SIZE)
+	duk__strtable_intcache_remove(heap, h);
+#endif
+	DUK_HEAP_PROTOCACHE_CHECK(heap, h);
+
 	if (prev != NULL) {
 		/* Middle of list. */
 		prev->hdr.h_next = h->hdr.h_next;
@@ -1101,8 +1150,8 @@ DUK_INTERNAL void duk_heap_strtable_force_resize(duk_heap *heap) {
 
 DUK_INTERNAL void duk_heap_strtable_free(duk_heap *heap) {
 #if defined(DUK_USE_STRTAB_PTRCOMP)
-	duk_uint16_t *strtable;
-	duk_uint16_t *st;
+	duk_heapptr_t *strtable;
+	duk_heapptr_t *st;
 #else
 	duk_hstring **strtable;
 	duk_hstring **st;
@@ -6,6 +6,39 @@
 #if !defined(DUK_HEAPHDR_H_INCLUDED)
 #define DUK_HEAPHDR_H_INCLUDED
 
+/*
+ *  Heap pointer compression
+ *
+ *  With DUK_USE_HEAPPTR16 or DUK_USE_HEAPPTR32 pointers to Duktape heap
+ *  allocations are stored in compressed form using user provided encode
+ *  and decode macros.  Both variants share the same code paths, only the
+ *  storage width differs: a 16-bit encoding suits small embedded heaps,
+ *  while a 32-bit encoding allows e.g. a 64-bit target to reserve a 4GB
+ *  (or larger with coarser granularity) region for the Duktape heap and
+ *  store offsets.  Fields holding compressed pointers keep their '16'
+ *  suffix (e.g. 'h_next16') regardless of the storage width.
+ */
+
+#if defined(DUK_USE_HEAPPTR16) && defined(DUK_USE_HEAPPTR32)
+#error DUK_USE_HEAPPTR16 and DUK_USE_HEAPPTR32 are mutually exclusive
+#endif
+
+#if defined(DUK_USE_HEAPPTR16)
+#define DUK_HEAPPTR_COMPRESSED
+typedef duk_uint16_t duk_heapptr_t;
+#define DUK_HEAPPTR_ENC(udata, ptr) DUK_USE_HEAPPTR_ENC16((udata), (ptr))
+#define DUK_HEAPPTR_DEC(udata, val) DUK_USE_HEAPPTR_DEC16((udata), (val))
+#elif defined(DUK_USE_HEAPPTR32)
+#define DUK_HEAPPTR_COMPRESSED
+typedef duk_uint32_t duk_heapptr_t;
+#define DUK_HEAPPTR_ENC(udata, ptr) DUK_USE_HEAPPTR_ENC32((udata), (ptr))
+#define DUK_HEAPPTR_DEC(udata, val) DUK_USE_HEAPPTR_DEC32((udata), (val))
+#endif
+
+#if defined(DUK_USE_STRTAB_PTRCOMP) && !defined(DUK_HEAPPTR_COMPRESSED)
+#error DUK_USE_STRTAB_PTRCOMP requires DUK_USE_HEAPPTR16 or DUK_USE_HEAPPTR32
+#endif
+
 /*
  *  Common heap header
  *
@@ -51,16 +84,16 @@ struct duk_heaphdr {
 #endif
 #endif /* DUK_USE_REFERENCE_COUNTING */
 
-#if defined(DUK_USE_HEAPPTR16)
-	duk_uint16_t h_next16;
+#if defined(DUK_HEAPPTR_COMPRESSED)
+	duk_heapptr_t h_next16;
 #else
 	duk_heaphdr *h_next;
 #endif
 
 #if defined(DUK_USE_DOUBLE_LINKED_HEAP)
 	/* refcounting requires direct heap frees, which in turn requires a dual linked heap */
-#if defined(DUK_USE_HEAPPTR16)
-	duk_uint16_t h_prev16;
+#if defined(DUK_HEAPPTR_COMPRESSED)
+	duk_heapptr_t h_prev16;
 #else
 	duk_heaphdr *h_prev;
 #endif
@@ -72,10 +105,11 @@ struct duk_heaphdr {
 	 * heap objects when 16-bit packing is used.  This field is now
 	 * conditional to DUK_USE_HEAPPTR16 only, but it is intended to be
 	 * used with DUK_USE_REFCOUNT16 and DUK_USE_DOUBLE_LINKED_HEAP;
-	 * this only matter to low memory environments anyway.
+	 * this only matter to low memory environments anyway.  With
+	 * DUK_USE_HEAPPTR32 the field is 32 bits and serves the same role.
 	 */
-#if defined(DUK_USE_HEAPPTR16)
-	duk_uint16_t h_extra16;
+#if defined(DUK_HEAPPTR_COMPRESSED)
+	duk_heapptr_t h_extra16;
 #endif
 };
 
@@ -135,11 +169,11 @@ struct duk_heaphdr_string {
 #define DUK_HTYPE_BUFFER 2
 #define DUK_HTYPE_MAX    2
 
-#if defined(DUK_USE_HEAPPTR16)
-#define DUK_HEAPHDR_GET_NEXT(heap, h) ((duk_heaphdr *) DUK_USE_HEAPPTR_DEC16((heap)->heap_udata, (h)->h_next16))
+#if defined(DUK_HEAPPTR_COMPRESSED)
+#define DUK_HEAPHDR_GET_NEXT(heap, h) ((duk_heaphdr *) DUK_HEAPPTR_DEC((heap)->heap_udata, (h)->h_next16))
 #define DUK_HEAPHDR_SET_NEXT(heap, h, val) \
 	do { \
-		(h)->h_next16 = DUK_USE_HEAPPTR_ENC16((heap)->heap_udata, (void *) val); \
+		(h)->h_next16 = DUK_HEAPPTR_ENC((heap)->heap_udata, (void *) val); \
 	} while (0)
 #else
 #define DUK_HEAPHDR_GET_NEXT(heap, h) ((h)->h_next)
@@ -150,11 +184,11 @@ struct duk_heaphdr_string {
 #endif
 
 #if defined(DUK_USE_DOUBLE_LINKED_HEAP)
-#if defined(DUK_USE_HEAPPTR16)
-#define DUK_HEAPHDR_GET_PREV(heap, h) ((duk_heaphdr *) DUK_USE_HEAPPTR_DEC16((heap)->heap_udata, (h)->h_prev16))
+#if defined(DUK_HEAPPTR_COMPRESSED)
+#define DUK_HEAPHDR_GET_PREV(heap, h) ((duk_heaphdr *) DUK_HEAPPTR_DEC((heap)->heap_udata, (h)->h_prev16))
 #define DUK_HEAPHDR_SET_PREV(heap, h, val) \
 	do { \
-		(h)->h_prev16 = DUK_USE_HEAPPTR_ENC16((heap)->heap_udata, (void *) (val)); \
+		(h)->h_prev16 = DUK_HEAPPTR_ENC((heap)->heap_udata, (void *) (val)); \
 	} while (0)
 #else
 #define DUK_HEAPHDR_GET_PREV(heap, h) ((h)->h_prev)
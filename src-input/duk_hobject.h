@@ -336,11 +336,11 @@ DUK_INTERNAL_DECL void duk_hobject_assert_valid(duk_hobject *h);
  *  Macros to access the 'props' allocation.
  */
 
-#if defined(DUK_USE_HEAPPTR16)
-#define DUK_HOBJECT_GET_PROPS(heap, h) ((duk_uint8_t *) DUK_USE_HEAPPTR_DEC16((heap)->heap_udata, ((duk_heaphdr *) (h))->h_extra16))
+#if defined(DUK_HEAPPTR_COMPRESSED)
+#define DUK_HOBJECT_GET_PROPS(heap, h) ((duk_uint8_t *) DUK_HEAPPTR_DEC((heap)->heap_udata, ((duk_heaphdr *) (h))->h_extra16))
 #define DUK_HOBJECT_SET_PROPS(heap, h, x) \
 	do { \
-		((duk_heaphdr *) (h))->h_extra16 = DUK_USE_HEAPPTR_ENC16((heap)->heap_udata, (void *) (x)); \
+		((duk_heaphdr *) (h))->h_extra16 = DUK_HEAPPTR_ENC((heap)->heap_udata, (void *) (x)); \
 	} while (0)
 #else
 #define DUK_HOBJECT_GET_PROPS(heap, h) ((h)->props)
@@ -631,11 +631,11 @@ DUK_INTERNAL_DECL void duk_hobject_assert_valid(duk_hobject *h);
  *  Macros for property handling
  */
 
-#if defined(DUK_USE_HEAPPTR16)
-#define DUK_HOBJECT_GET_PROTOTYPE(heap, h) ((duk_hobject *) DUK_USE_HEAPPTR_DEC16((heap)->heap_udata, (h)->prototype16))
+#if defined(DUK_HEAPPTR_COMPRESSED)
+#define DUK_HOBJECT_GET_PROTOTYPE(heap, h) ((duk_hobject *) DUK_HEAPPTR_DEC((heap)->heap_udata, (h)->prototype16))
 #define DUK_HOBJECT_SET_PROTOTYPE(heap, h, x) \
 	do { \
-		(h)->prototype16 = DUK_USE_HEAPPTR_ENC16((heap)->heap_udata, (void *) (x)); \
+		(h)->prototype16 = DUK_HEAPPTR_ENC((heap)->heap_udata, (void *) (x)); \
 	} while (0)
 #else
 #define DUK_HOBJECT_GET_PROTOTYPE(heap, h) ((h)->prototype)
@@ -666,7 +666,7 @@ DUK_INTERNAL_DECL void duk_hobject_assert_valid(duk_hobject *h);
  *  Finalizer check
  */
 
-#if defined(DUK_USE_HEAPPTR16)
+#if defined(DUK_HEAPPTR_COMPRESSED)
 #define DUK_HOBJECT_HAS_FINALIZER_FAST(heap, h) duk_hobject_has_finalizer_fast_raw((heap), (h))
 #else
 #define DUK_HOBJECT_HAS_FINALIZER_FAST(heap, h) duk_hobject_has_finalizer_fast_raw((h))
@@ -807,7 +807,7 @@ struct duk_hobject {
 	 *  possible to make accessing them as fast a possible.
 	 */
 
-#if defined(DUK_USE_HEAPPTR16)
+#if defined(DUK_HEAPPTR_COMPRESSED)
 	/* Located in duk_heaphdr h_extra16.  Subclasses of duk_hobject (like
 	 * duk_hcompfunc) are not free to use h_extra16 for this reason.
 	 */
@@ -816,8 +816,8 @@ struct duk_hobject {
 #endif
 
 	/* prototype: the only internal property lifted outside 'e' as it is so central */
-#if defined(DUK_USE_HEAPPTR16)
-	duk_uint16_t prototype16;
+#if defined(DUK_HEAPPTR_COMPRESSED)
+	duk_heapptr_t prototype16;
 #else
 	duk_hobject *prototype;
 #endif
@@ -915,7 +915,7 @@ DUK_INTERNAL_DECL void duk_hobject_define_property_internal_arridx(duk_hthread *
                                                                    duk_uarridx_t arr_idx,
                                                                    duk_small_uint_t flags);
 DUK_INTERNAL_DECL duk_size_t duk_hobject_get_length(duk_hthread *thr, duk_hobject *obj);
-#if defined(DUK_USE_HEAPPTR16)
+#if defined(DUK_HEAPPTR_COMPRESSED)
 DUK_INTERNAL_DECL duk_bool_t duk_hobject_has_finalizer_fast_raw(duk_heap *heap, duk_hobject *obj);
 #else
 DUK_INTERNAL_DECL duk_bool_t duk_hobject_has_finalizer_fast_raw(duk_hobject *obj);
@@ -26,6 +26,11 @@
  */
 #define DUK__ENUM_START_INDEX 2
 
+/* Minimum number of keys for which a radix sort is used instead of an
+ * insertion sort.
+ */
+#define DUK__ENUM_RADIX_SORT_LIMIT 64
+
 /* Current implementation suffices for ES2015 for now because there's no symbol
  * sorting, so commented out for now.
  */
@@ -52,6 +57,10 @@
  *  in-place, (3) minimizes operations if data is already nearly sorted,
  *  (4) doesn't reorder elements considered equal.
  *  http://en.wikipedia.org/wiki/Insertion_sort
+ *
+ *  Insertion sort is quadratic for keys in random order, e.g. index keys
+ *  inserted into a plain object out of order, so large key sets use a
+ *  linear time radix sort instead unless DUK_USE_PREFER_SIZE is set.
  */
 
 /* Sort key, must hold array indices, "not array index" marker, and one more
@@ -104,9 +113,112 @@ DUK_LOCAL duk_bool_t duk__sort_compare_es6(duk_hstring *a, duk_hstring *b, duk__
 	}
 }
 
+#if !defined(DUK_USE_PREFER_SIZE)
+/* Sort 'n' keys into ES2015 order in linear time.  Keys are first
+ * partitioned stably into array indices, strings, and symbols, after
+ * which the array index keys are sorted with an LSD radix sort, 8 bits
+ * per pass.  Passes where all keys have the same digit are skipped, so
+ * e.g. indices below 65536 need at most two passes.
+ */
+DUK_LOCAL void duk__sort_enum_keys_radix(duk_hthread *thr, duk_hobject *h_obj, duk_int_fast32_t idx_start, duk_int_fast32_t n) {
+	duk_uint32_t *counts;
+	duk_hstring **keys;
+	duk_hstring **tmp;
+	duk_hstring **src;
+	duk_hstring **dst;
+	duk_hstring **p_idx;
+	duk_hstring **p_str;
+	duk_hstring **p_sym;
+	duk_hstring *h;
+	duk_int_fast32_t i;
+	duk_int_fast32_t n_idx;
+	duk_int_fast32_t n_str;
+	duk_uint32_t sum;
+	duk_uint32_t tmp_count;
+	duk_small_uint_t shift;
+	duk_small_uint_t d;
+
+	DUK_ASSERT(n >= 2);
+
+	/* Temporary: digit counts followed by a key array.  Pushing the
+	 * buffer may trigger a GC which may resize the entry part, so look
+	 * up the key base only afterwards.
+	 */
+	counts = (duk_uint32_t *) duk_push_fixed_buffer_nozero(thr,
+	                                                       256U * sizeof(duk_uint32_t) +
+	                                                           (duk_size_t) n * sizeof(duk_hstring *));
+	tmp = (duk_hstring **) (void *) (counts + 256);
+	keys = DUK_HOBJECT_E_GET_KEY_BASE(thr->heap, h_obj) + idx_start;
+
+	n_idx = 0;
+	n_str = 0;
+	for (i = 0; i < n; i++) {
+		h = keys[i];
+		DUK_ASSERT(h != NULL);
+		tmp[i] = h;
+		if (DUK_HSTRING_HAS_ARRIDX(h)) {
+			n_idx++;
+		} else if (!DUK_HSTRING_HAS_SYMBOL(h)) {
+			n_str++;
+		}
+	}
+
+	p_idx = keys;
+	p_str = keys + n_idx;
+	p_sym = keys + n_idx + n_str;
+	for (i = 0; i < n; i++) {
+		h = tmp[i];
+		if (DUK_HSTRING_HAS_ARRIDX(h)) {
+			*p_idx++ = h;
+		} else if (!DUK_HSTRING_HAS_SYMBOL(h)) {
+			*p_str++ = h;
+		} else {
+			*p_sym++ = h;
+		}
+	}
+	DUK_ASSERT(p_idx == keys + n_idx);
+	DUK_ASSERT(p_str == keys + n_idx + n_str);
+	DUK_ASSERT(p_sym == keys + n);
+
+	src = keys;
+	dst = tmp;
+	for (shift = 0; shift < 32 && n_idx > 1; shift += 8) {
+		duk_memzero((void *) counts, 256U * sizeof(duk_uint32_t));
+		for (i = 0; i < n_idx; i++) {
+			counts[(duk_hstring_get_arridx_fast_known(src[i]) >> shift) & 0xffU]++;
+		}
+		if (counts[(duk_hstring_get_arridx_fast_known(src[0]) >> shift) & 0xffU] == (duk_uint32_t) n_idx) {
+			continue;
+		}
+
+		sum = 0;
+		for (d = 0; d < 256U; d++) {
+			tmp_count = counts[d];
+			counts[d] = sum;
+			sum += tmp_count;
+		}
+		for (i = 0; i < n_idx; i++) {
+			h = src[i];
+			dst[counts[(duk_hstring_get_arridx_fast_known(h) >> shift) & 0xffU]++] = h;
+		}
+
+		tmp = src;
+		src = dst;
+		dst = tmp;
+	}
+	if (src != keys) {
+		duk_memcpy((void *) keys, (const void *) src, (size_t) n_idx * sizeof(duk_hstring *));
+	}
+
+	duk_pop(thr);
+}
+#endif /* !DUK_USE_PREFER_SIZE */
+
 DUK_LOCAL void duk__sort_enum_keys_es6(duk_hthread *thr, duk_hobject *h_obj, duk_int_fast32_t idx_start, duk_int_fast32_t idx_end) {
 	duk_hstring **keys;
 	duk_int_fast32_t idx;
+	duk__sort_key_t val_prev;
+	duk__sort_key_t val_curr;
 
 	DUK_ASSERT(h_obj != NULL);
 	DUK_ASSERT(idx_start >= DUK__ENUM_START_INDEX);
@@ -119,10 +231,32 @@ DUK_LOCAL void duk__sort_enum_keys_es6(duk_hthread *thr, duk_hobject *h_obj, duk
 
 	keys = DUK_HOBJECT_E_GET_KEY_BASE(thr->heap, h_obj);
 
+	/* Keys are very often in order already, and then the rehash can
+	 * be skipped too.
+	 */
+	val_prev = duk__hstring_sort_key(keys[idx_start]);
+	for (idx = idx_start + 1; idx < idx_end; idx++) {
+		val_curr = duk__hstring_sort_key(keys[idx]);
+		if (val_curr < val_prev) {
+			break;
+		}
+		val_prev = val_curr;
+	}
+	if (idx == idx_end) {
+		DUK_DDD(DUK_DDDPRINT("keys already in order"));
+		return;
+	}
+
+#if !defined(DUK_USE_PREFER_SIZE)
+	if (idx_end - idx_start >= DUK__ENUM_RADIX_SORT_LIMIT) {
+		duk__sort_enum_keys_radix(thr, h_obj, idx_start, idx_end - idx_start);
+		goto rehash;
+	}
+#endif
+
 	for (idx = idx_start + 1; idx < idx_end; idx++) {
 		duk_hstring *h_curr;
 		duk_int_fast32_t idx_insert;
-		duk__sort_key_t val_curr;
 
 		h_curr = keys[idx];
 		DUK_ASSERT(h_curr != NULL);
@@ -166,6 +300,9 @@ DUK_LOCAL void duk__sort_enum_keys_es6(duk_hthread *thr, duk_hobject *h_obj, duk
 		}
 	}
 
+#if !defined(DUK_USE_PREFER_SIZE)
+rehash:
+#endif
 	/* Entry part has been reordered now with no side effects.
 	 * If the object has a hash part, it will now be incorrect
 	 * and we need to rehash.  Do that by forcing a resize to
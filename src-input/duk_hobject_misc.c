@@ -44,13 +44,14 @@ DUK_INTERNAL void duk_hobject_set_prototype_updref(duk_hthread *thr, duk_hobject
 	duk_hobject *tmp;
 
 	DUK_ASSERT(h);
+	DUK_HEAP_PROTOCACHE_CHECK(thr->heap, h);
 	tmp = DUK_HOBJECT_GET_PROTOTYPE(thr->heap, h);
 	DUK_HOBJECT_SET_PROTOTYPE(thr->heap, h, p);
 	DUK_HOBJECT_INCREF_ALLOWNULL(thr, p); /* avoid problems if p == h->prototype */
 	DUK_HOBJECT_DECREF_ALLOWNULL(thr, tmp);
 #else
 	DUK_ASSERT(h);
-	DUK_UNREF(thr);
+	DUK_HEAP_PROTOCACHE_CHECK(thr->heap, h);
 	DUK_HOBJECT_SET_PROTOTYPE(thr->heap, h, p);
 #endif
 }
@@ -1282,12 +1282,14 @@ DUK_LOCAL void duk__abandon_array_part(duk_hthread *thr, duk_hobject *obj) {
  *  May abandon the array part if it is computed to be too sparse.
  *
  *  This call is relatively expensive, as it needs to scan both the
- *  entries and the array part.
+ *  entries and the array part.  The resize itself is skipped if the
+ *  object is already compact, e.g. when compacting the same object
+ *  repeatedly.
  *
  *  The call may fail due to allocation error.
  */
 
-DUK_INTERNAL void duk_hobject_compact_props(duk_hthread *thr, duk_hobject *obj) {
+DUK_LOCAL void duk__compact_props(duk_hthread *thr, duk_hobject *obj, duk_bool_t force_abandon) {
 	duk_uint32_t e_size; /* currently used -> new size */
 	duk_uint32_t a_size; /* currently required */
 	duk_uint32_t a_used; /* actually used */
@@ -1316,7 +1318,7 @@ DUK_INTERNAL void duk_hobject_compact_props(duk_hthread *thr, duk_hobject *obj)
 	                   (long) a_size,
 	                   (double) a_used / (double) a_size));
 
-	if (duk__abandon_array_density_check(a_used, a_size)) {
+	if (force_abandon || duk__abandon_array_density_check(a_used, a_size)) {
 		DUK_DD(DUK_DDPRINT("decided to abandon array during compaction, a_used=%ld, a_size=%ld",
 		                   (long) a_used,
 		                   (long) a_size));
@@ -1344,9 +1346,21 @@ DUK_INTERNAL void duk_hobject_compact_props(duk_hthread *thr, duk_hobject *obj)
 	                   (long) h_size,
 	                   (long) abandon_array));
 
+	if (e_size == DUK_HOBJECT_GET_ENEXT(obj) && e_size == DUK_HOBJECT_GET_ESIZE(obj) &&
+	    a_size == DUK_HOBJECT_GET_ASIZE(obj) && h_size == DUK_HOBJECT_GET_HSIZE(obj) &&
+	    (!abandon_array || !DUK_HOBJECT_HAS_ARRAY_PART(obj))) {
+		/* No gaps in the entry part and all sizes match. */
+		DUK_DD(DUK_DDPRINT("hobject already compact, skip resize"));
+		return;
+	}
+
 	duk_hobject_realloc_props(thr, obj, e_size, a_size, h_size, abandon_array);
 }
 
+DUK_INTERNAL void duk_hobject_compact_props(duk_hthread *thr, duk_hobject *obj) {
+	duk__compact_props(thr, obj, 0 /*force_abandon*/);
+}
+
 /*
  *  Find an existing key from entry part either by linear scan or by
  *  using the hash index (if it exists).
@@ -1535,6 +1549,9 @@ DUK_LOCAL duk_int_t duk__hobject_alloc_entry_checked(duk_hthread *thr, duk_hobje
 	DUK_ASSERT(DUK_HOBJECT_GET_ENEXT(obj) < DUK_HOBJECT_GET_ESIZE(obj));
 	idx = DUK_HOBJECT_POSTINC_ENEXT(obj);
 
+	/* New key may shadow a cached inherited lookup. */
+	DUK_HEAP_PROTOCACHE_CHECK(thr->heap, obj);
+
 	/* previous value is assumed to be garbage, so don't touch it */
 	DUK_HOBJECT_E_SET_KEY(thr->heap, obj, idx, key);
 	DUK_HSTRING_INCREF(thr, key);
@@ -2575,6 +2592,10 @@ DUK_INTERNAL duk_bool_t duk_hobject_getprop(duk_hthread *thr, duk_tval *tv_obj,
 	duk_uint32_t arr_idx = DUK__NO_ARRAY_INDEX;
 	duk_propdesc desc;
 	duk_uint_t sanity;
+#if defined(DUK_USE_PROTOCACHE_SIZE)
+	duk_bool_t cache_lookup;
+	duk_hobject *cache_start = NULL;
+#endif
 
 	DUK_DDD(DUK_DDDPRINT("getprop: thr=%p, obj=%p, key=%p (obj -> %!T, key -> %!T)",
 	                     (void *) thr,
@@ -2932,16 +2953,44 @@ lookup:
 	DUK_ASSERT(key != NULL);
 
 	sanity = DUK_HOBJECT_PROTOTYPE_CHAIN_SANITY;
+#if defined(DUK_USE_PROTOCACHE_SIZE)
+	/* Inherited lookups use the prototype chain lookup cache once the
+	 * own property lookup of the first object fails: each prototype is
+	 * probed until there's a hit, and the result is then cached for the
+	 * first prototype.  Array index keys and 'length' may be virtual
+	 * properties so they're not cached.
+	 */
+	cache_lookup = (arr_idx == DUK__NO_ARRAY_INDEX && key != DUK_HTHREAD_STRING_LENGTH(thr));
+#endif
 	do {
 		if (!duk__get_own_propdesc_raw(thr, curr, key, arr_idx, &desc, DUK_GETDESC_FLAG_PUSH_VALUE)) {
 			goto next_in_chain;
 		}
 
+#if defined(DUK_USE_PROTOCACHE_SIZE)
+		if (cache_start != NULL) {
+			duk_heap_protocache_insert(thr->heap, cache_start, key, curr);
+		}
+#endif
+
 		if (desc.get != NULL) {
+#if defined(DUK_USE_NATIVE_ACCESSOR_FASTPATH)
+			duk_c_function direct_func;
+#endif
+
 			/* accessor with defined getter */
 			DUK_ASSERT((desc.flags & DUK_PROPDESC_FLAG_ACCESSOR) != 0);
 
 			duk_pop_unsafe(thr); /* [key undefined] -> [key] */
+#if defined(DUK_USE_NATIVE_ACCESSOR_FASTPATH)
+			direct_func = duk_call_direct_getter_func(thr, desc.get);
+			if (direct_func != NULL) {
+				/* Simple built-in getter, call without an activation. */
+				duk_push_tval(thr, tv_obj); /* note: original, uncoerced base */
+				duk_call_natfunc_direct(thr, direct_func, 0); /* [key this] -> [key retval] */
+				goto found;
+			}
+#endif
 			duk_push_hobject(thr, desc.get);
 			duk_push_tval(thr, tv_obj); /* note: original, uncoerced base */
 #if defined(DUK_USE_NONSTD_GETTER_KEY_ARGUMENT)
@@ -2977,12 +3026,41 @@ lookup:
 			DUK_WO_NORETURN(return 0;);
 		}
 		curr = DUK_HOBJECT_GET_PROTOTYPE(thr->heap, curr);
+#if defined(DUK_USE_PROTOCACHE_SIZE)
+		if (cache_lookup && curr != NULL) {
+			duk_hobject *holder;
+
+			if (duk_heap_protocache_lookup(thr->heap, curr, key, &holder)) {
+				/* Continue from the holder whose own lookup
+				 * provides the value, or skip the rest of the
+				 * chain if the property is not found.
+				 */
+				if (cache_start != NULL) {
+					duk_heap_protocache_insert(thr->heap, cache_start, key, holder);
+					cache_start = NULL;
+				}
+				cache_lookup = 0;
+				curr = holder;
+			} else {
+				if (cache_start == NULL) {
+					cache_start = curr;
+				}
+				DUK_HEAP_PROTOCACHE_MARK(thr->heap, curr);
+			}
+		}
+#endif
 	} while (curr != NULL);
 
 	/*
 	 *  Not found
 	 */
 
+#if defined(DUK_USE_PROTOCACHE_SIZE)
+	if (cache_start != NULL) {
+		duk_heap_protocache_insert(thr->heap, cache_start, key, NULL);
+	}
+#endif
+
 	duk_to_undefined(thr, -1); /* [key] -> [undefined] (default value) */
 
 	DUK_DDD(DUK_DDDPRINT("-> %!T (not found)", (duk_tval *) duk_get_tval(thr, -1)));
@@ -3944,6 +4022,9 @@ lookup:
 			 */
 
 			duk_hobject *setter;
+#if defined(DUK_USE_NATIVE_ACCESSOR_FASTPATH)
+			duk_c_function direct_func;
+#endif
 
 			DUK_DD(DUK_DDPRINT("put to an own or inherited accessor, calling setter"));
 
@@ -3951,6 +4032,17 @@ lookup:
 			if (!setter) {
 				goto fail_no_setter;
 			}
+#if defined(DUK_USE_NATIVE_ACCESSOR_FASTPATH)
+			direct_func = duk_call_direct_setter_func(thr, setter);
+			if (direct_func != NULL) {
+				/* Simple built-in setter, call without an activation. */
+				duk_push_tval(thr, tv_obj); /* note: original, uncoerced base */
+				duk_push_tval(thr, tv_val); /* [key this val] */
+				duk_call_natfunc_direct(thr, direct_func, 1); /* [key this val] -> [key retval] */
+				duk_pop_unsafe(thr); /* ignore retval -> [key] */
+				goto success_no_arguments_exotic;
+			}
+#endif
 			duk_push_hobject(thr, setter);
 			duk_push_tval(thr, tv_obj); /* note: original, uncoerced base */
 			duk_push_tval(thr, tv_val); /* [key setter this val] */
@@ -4572,6 +4664,7 @@ DUK_INTERNAL duk_bool_t duk_hobject_delprop_raw(duk_hthread *thr, duk_hobject *o
 		DUK_ASSERT(key == DUK_HOBJECT_E_GET_KEY(thr->heap, obj, desc.e_idx));
 		DUK_HOBJECT_E_SET_KEY(thr->heap, obj, desc.e_idx, NULL);
 		DUK_HSTRING_DECREF_NORZ(thr, key);
+		DUK_HEAP_PROTOCACHE_CHECK(thr->heap, obj);
 
 		/* Trigger refzero side effects only when we're done as a
 		 * finalizer might operate on the object and affect the
@@ -5052,7 +5145,7 @@ DUK_INTERNAL duk_size_t duk_hobject_get_length(duk_hthread *thr, duk_hobject *ob
  *  in sync with the actual property when setting/removing the finalizer.
  */
 
-#if defined(DUK_USE_HEAPPTR16)
+#if defined(DUK_HEAPPTR_COMPRESSED)
 DUK_INTERNAL duk_bool_t duk_hobject_has_finalizer_fast_raw(duk_heap *heap, duk_hobject *obj) {
 #else
 DUK_INTERNAL duk_bool_t duk_hobject_has_finalizer_fast_raw(duk_hobject *obj) {
@@ -5070,7 +5163,7 @@ DUK_INTERNAL duk_bool_t duk_hobject_has_finalizer_fast_raw(duk_hobject *obj) {
 			DUK_D(DUK_DPRINT("prototype loop when checking for finalizer existence; returning false"));
 			return 0;
 		}
-#if defined(DUK_USE_HEAPPTR16)
+#if defined(DUK_HEAPPTR_COMPRESSED)
 		DUK_ASSERT(heap != NULL);
 		obj = DUK_HOBJECT_GET_PROTOTYPE(heap, obj);
 #else
@@ -6253,19 +6346,22 @@ DUK_INTERNAL void duk_hobject_object_seal_freeze_helper(duk_hthread *thr, duk_ho
 #endif
 
 	/*
-	 *  Abandon array part because all properties must become non-configurable.
-	 *  Note that this is now done regardless of whether this is always the case
-	 *  (skips check, but performance problem if caller would do this many times
-	 *  for the same object; not likely).
+	 *  Abandon array part because all properties must become non-configurable,
+	 *  and compact the object in the same resize as it can no longer gain new
+	 *  properties.  The resize is skipped entirely when the object is already
+	 *  compact and has no array part, which is the common case for object
+	 *  literals and for objects frozen more than once (e.g. by deep freeze
+	 *  helpers).  Only the property flag bytes are then updated.
 	 */
 
-	duk__abandon_array_part(thr, obj);
+	duk__compact_props(thr, obj, 1 /*force_abandon*/);
 	DUK_ASSERT(DUK_HOBJECT_GET_ASIZE(obj) == 0);
+	DUK_ASSERT(!DUK_HOBJECT_HAS_ARRAY_PART(obj));
 
 	for (i = 0; i < DUK_HOBJECT_GET_ENEXT(obj); i++) {
 		duk_uint8_t *fp;
 
-		/* since duk__abandon_array_part() causes a resize, there should be no gaps in keys */
+		/* compaction guarantees there are no gaps in keys */
 		DUK_ASSERT(DUK_HOBJECT_E_GET_KEY(thr->heap, obj, i) != NULL);
 
 		/* avoid multiple computations of flags address; bypasses macros */
@@ -6279,10 +6375,6 @@ DUK_INTERNAL void duk_hobject_object_seal_freeze_helper(duk_hthread *thr, duk_ho
 
 	DUK_HOBJECT_CLEAR_EXTENSIBLE(obj);
 
-	/* no need to compact since we already did that in duk__abandon_array_part()
-	 * (regardless of whether an array part existed or not.
-	 */
-
 	return;
 }
 
@@ -118,8 +118,8 @@
 #if defined(DUK_USE_ROM_STRINGS)
 #define DUK_HTHREAD_GET_STRING(thr, idx) ((duk_hstring *) DUK_LOSE_CONST(duk_rom_strings_stridx[(idx)]))
 #else /* DUK_USE_ROM_STRINGS */
-#if defined(DUK_USE_HEAPPTR16)
-#define DUK_HTHREAD_GET_STRING(thr, idx) ((duk_hstring *) DUK_USE_HEAPPTR_DEC16((thr)->heap->heap_udata, (thr)->strs16[(idx)]))
+#if defined(DUK_HEAPPTR_COMPRESSED)
+#define DUK_HTHREAD_GET_STRING(thr, idx) ((duk_hstring *) DUK_HEAPPTR_DEC((thr)->heap->heap_udata, (thr)->strs16[(idx)]))
 #else
 #define DUK_HTHREAD_GET_STRING(thr, idx) ((thr)->strs[(idx)])
 #endif
@@ -377,8 +377,8 @@ struct duk_hthread {
 #if defined(DUK_USE_ROM_STRINGS)
 	/* No field needed when strings are in ROM. */
 #else
-#if defined(DUK_USE_HEAPPTR16)
-	duk_uint16_t *strs16;
+#if defined(DUK_HEAPPTR_COMPRESSED)
+	duk_heapptr_t *strs16;
 #else
 	duk_hstring **strs;
 #endif
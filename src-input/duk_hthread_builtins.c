@@ -779,12 +779,15 @@ DUK_INTERNAL void duk_hthread_create_builtin_objects(duk_hthread *thr) {
 #if defined(DUK_USE_STRTAB_PTRCOMP)
 	                "s"
 #endif
-#if !defined(DUK_USE_HEAPPTR16) && !defined(DUK_DATAPTR16) && !defined(DUK_FUNCPTR16)
+#if !defined(DUK_HEAPPTR_COMPRESSED) && !defined(DUK_DATAPTR16) && !defined(DUK_FUNCPTR16)
 	                "n"
 #endif
 #if defined(DUK_USE_HEAPPTR16)
 	                "h"
 #endif
+#if defined(DUK_USE_HEAPPTR32)
+	                "w"
+#endif
 #if defined(DUK_USE_DATAPTR16)
 	                "d"
 #endif
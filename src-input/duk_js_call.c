@@ -582,26 +582,37 @@ DUK_LOCAL void duk__handle_bound_chain_for_call(duk_hthread *thr, duk_idx_t idx_
 
 			/* [ ... func this arg1 ... argN ] */
 
+			/* Bound arguments are inserted first: the value stack
+			 * may be resized, but there are no other side effects.
+			 * The bound function stays reachable at idx_func until
+			 * it is replaced by the target below.
+			 */
+			if (len > 0) {
+				duk_require_stack(thr, len);
+
+				tv_gap = duk_reserve_gap(thr, idx_func + 2, len);
+				duk_copy_tvals_incref(thr, tv_gap, tv_args, (duk_size_t) len);
+			}
+
+			/* [ ... func this <bound args> arg1 ... argN ] */
+
+			/* The 'this' and target updates are made in place.  The
+			 * DECREF of the previous value may have side effects
+			 * (finalizers) which may resize the value stack, so the
+			 * slot pointers are looked up right before each update.
+			 * The UPDREF macros INCREF the new value before the old
+			 * one is DECREF'd, so replacing the bound function (which
+			 * may then be freed) with its own target is safe.
+			 */
 			if (is_constructor_call) {
 				/* See: tests/ecmascript/test-spec-bound-constructor.js */
 				DUK_DDD(DUK_DDDPRINT("constructor call: don't update this binding"));
 			} else {
-				/* XXX: duk_replace_tval */
-				duk_push_tval(thr, &h_bound->this_binding);
-				duk_replace(thr, idx_func + 1); /* idx_this = idx_func + 1 */
+				/* idx_this = idx_func + 1 */
+				DUK_TVAL_SET_TVAL_UPDREF(thr, DUK_GET_TVAL_POSIDX(thr, idx_func + 1), &h_bound->this_binding);
 			}
 
-			/* [ ... func this arg1 ... argN ] */
-
-			duk_require_stack(thr, len);
-
-			tv_gap = duk_reserve_gap(thr, idx_func + 2, len);
-			duk_copy_tvals_incref(thr, tv_gap, tv_args, (duk_size_t) len);
-
-			/* [ ... func this <bound args> arg1 ... argN ] */
-
-			duk_push_tval(thr, &h_bound->target);
-			duk_replace(thr, idx_func); /* replace in stack */
+			DUK_TVAL_SET_TVAL_UPDREF(thr, DUK_GET_TVAL_POSIDX(thr, idx_func), &h_bound->target);
 
 			DUK_DDD(DUK_DDDPRINT("bound function handled, idx_func=%ld, curr func=%!T",
 			                     (long) idx_func,
@@ -978,6 +989,16 @@ DUK_LOCAL void duk__handle_oldenv_for_call(duk_hthread *thr, duk_hobject *func,
 	f = (duk_hcompfunc *) func;
 	h_lex = DUK_HCOMPFUNC_GET_LEXENV(thr->heap, f);
 	h_var = DUK_HCOMPFUNC_GET_VARENV(thr->heap, f);
+#if defined(DUK_USE_ROM_OBJECTS)
+	/* Compiled functions in ROM have no environment pointers, they
+	 * always execute in the global environment.
+	 */
+	if (DUK_UNLIKELY(h_lex == NULL)) {
+		DUK_ASSERT(DUK_HEAPHDR_HAS_READONLY((duk_heaphdr *) func));
+		h_lex = thr->builtins[DUK_BIDX_GLOBAL_ENV];
+		h_var = thr->builtins[DUK_BIDX_GLOBAL_ENV];
+	}
+#endif
 	DUK_ASSERT(h_lex != NULL); /* Always true for closures (not for templates) */
 	DUK_ASSERT(h_var != NULL);
 	act->lex_env = h_lex;
@@ -1465,6 +1486,7 @@ DUK_LOCAL duk_small_uint_t duk__call_setup_act_attempt_tailcall(duk_hthread *thr
 	duk_tval *tv1, *tv2;
 	duk_idx_t idx_args;
 	duk_small_uint_t flags1, flags2;
+	duk_small_uint_t prevent_yield;
 #if defined(DUK_USE_DEBUGGER_SUPPORT)
 	duk_activation *prev_pause_act;
 #endif
@@ -1484,10 +1506,6 @@ DUK_LOCAL duk_small_uint_t duk__call_setup_act_attempt_tailcall(duk_hthread *thr
 		DUK_DDD(DUK_DDDPRINT("tail call prevented by target not being ecma function"));
 		return 0;
 	}
-	if (act->flags & DUK_ACT_FLAG_PREVENT_YIELD) {
-		DUK_DDD(DUK_DDDPRINT("tail call prevented by current activation having DUK_ACT_FLAG_PREVENT_YIELD"));
-		return 0;
-	}
 	/* Tailcall is only allowed if current and candidate
 	 * function have identical return value handling.  There
 	 * are three possible return value handling cases:
@@ -1547,9 +1565,17 @@ DUK_LOCAL duk_small_uint_t duk__call_setup_act_attempt_tailcall(duk_hthread *thr
 	DUK_ASSERT(!DUK_HOBJECT_HAS_BOUNDFUNC(func));
 	DUK_ASSERT(!DUK_HOBJECT_HAS_NATFUNC(func));
 	DUK_ASSERT(DUK_HOBJECT_HAS_COMPFUNC(func));
-	DUK_ASSERT((act->flags & DUK_ACT_FLAG_PREVENT_YIELD) == 0);
 	DUK_ASSERT(call_flags & DUK_CALL_FLAG_ALLOW_ECMATOECMA);
 
+	/* If the current activation was called from native code (or is
+	 * otherwise yield preventing), the reused activation must keep
+	 * preventing yields: the native caller is still on the C stack.
+	 * The unwind below decrements callstack_preventcount so it is
+	 * restored when the flag is reapplied.  See:
+	 * test-bug-tailcall-preventyield-assert.c.
+	 */
+	prevent_yield = (duk_small_uint_t) (act->flags & DUK_ACT_FLAG_PREVENT_YIELD);
+
 	/* Unwind the topmost callstack entry before reusing it.  This
 	 * also unwinds the catchers related to the topmost entry.
 	 */
@@ -1598,7 +1624,10 @@ DUK_LOCAL duk_small_uint_t duk__call_setup_act_attempt_tailcall(duk_hthread *thr
 	DUK_TVAL_SET_OBJECT(&act->tv_func, func); /* borrowed, no refcount */
 	DUK_HOBJECT_INCREF(thr, func);
 
-	act->flags = DUK_ACT_FLAG_TAILCALLED;
+	act->flags = DUK_ACT_FLAG_TAILCALLED | prevent_yield;
+	if (prevent_yield) {
+		thr->callstack_preventcount++;
+	}
 	if (DUK_HOBJECT_HAS_STRICT(func)) {
 		act->flags |= DUK_ACT_FLAG_STRICT;
 	}
@@ -1991,12 +2020,16 @@ DUK_LOCAL duk_int_t duk__handle_call_raw(duk_hthread *thr, duk_idx_t idx_func, d
 		/* No entry in the catch stack which would actually catch a
 		 * throw can refer to the callstack entry being reused.
 		 * There *can* be catch stack entries referring to the current
-		 * callstack entry as long as they don't catch (e.g. label sites).
+		 * callstack entry as long as they don't catch (e.g. label sites
+		 * and 'with' statements).
 		 */
 
 		tmp_act = thr->callstack_curr;
 		for (tmp_cat = tmp_act->cat; tmp_cat != NULL; tmp_cat = tmp_cat->parent) {
-			DUK_ASSERT(DUK_CAT_GET_TYPE(tmp_cat) == DUK_CAT_TYPE_LABEL); /* a non-catching entry */
+			/* a non-catching entry */
+			DUK_ASSERT(DUK_CAT_GET_TYPE(tmp_cat) == DUK_CAT_TYPE_LABEL ||
+			           (DUK_CAT_GET_TYPE(tmp_cat) == DUK_CAT_TYPE_TCF && !DUK_CAT_HAS_CATCH_ENABLED(tmp_cat) &&
+			            !DUK_CAT_HAS_FINALLY_ENABLED(tmp_cat)));
 		}
 	}
 #endif /* DUK_USE_ASSERTIONS */
@@ -2209,7 +2242,7 @@ DUK_LOCAL duk_int_t duk__handle_call_raw(duk_hthread *thr, duk_idx_t idx_func, d
 		if (call_flags & DUK_CALL_FLAG_ALLOW_ECMATOECMA) {
 			DUK_DD(DUK_DDPRINT("avoid native call, use existing executor"));
 			DUK_STATS_INC(thr->heap, stats_call_ecmatoecma);
-			DUK_ASSERT((act->flags & DUK_ACT_FLAG_PREVENT_YIELD) == 0);
+			DUK_ASSERT(use_tailcall || (act->flags & DUK_ACT_FLAG_PREVENT_YIELD) == 0);
 			DUK_REFZERO_CHECK_FAST(thr);
 			DUK_ASSERT(thr->ptr_curr_pc == NULL);
 			thr->heap->call_recursion_depth--; /* No recursion increase for this case. */
@@ -2414,6 +2447,118 @@ DUK_INTERNAL duk_int_t duk_handle_call_unprotected(duk_hthread *thr, duk_idx_t i
 	return duk__handle_call_raw(thr, idx_func, call_flags);
 }
 
+/*
+ *  duk_call_natfunc_direct(): call a native function directly, without
+ *  creating an activation.
+ *
+ *  Used by property code for built-in accessors (e.g. typed array
+ *  .byteLength) whose call overhead dominates their actual work.  The
+ *  target sees a normal native call frame: 'this' is the value below
+ *  valstack_bottom and the arguments start at index 0.  Because there's
+ *  no activation, the target must not depend on the current activation:
+ *  magic, current function, constructor call status, or yield.  Errors
+ *  are thrown normally; catchers restore valstack_bottom and valstack_end
+ *  from their own saved state so the temporary bottom needs no unwinding.
+ *
+ *  [ ... this arg1 ... argN ] -> [ ... retval ]
+ */
+
+#if defined(DUK_USE_NATIVE_ACCESSOR_FASTPATH)
+/* Return the C function of a built-in getter which can be called directly,
+ * NULL otherwise.  Listed getters don't use magic, the current function, or
+ * a key argument.
+ */
+DUK_INTERNAL duk_c_function duk_call_direct_getter_func(duk_hthread *thr, duk_hobject *getter) {
+	duk_c_function func;
+
+	DUK_ASSERT(getter != NULL);
+
+	if (DUK_UNLIKELY(thr->callstack_curr == NULL || !DUK_HOBJECT_IS_NATFUNC(getter))) {
+		return NULL;
+	}
+	func = ((duk_hnatfunc *) getter)->func;
+	if (func == duk_bi_typedarray_bytelength_getter || func == duk_bi_typedarray_byteoffset_getter ||
+#if defined(DUK_USE_BUFFEROBJECT_SUPPORT)
+	    func == duk_bi_typedarray_buffer_getter ||
+#endif
+	    func == duk_bi_error_prototype_stack_getter || func == duk_bi_error_prototype_filename_getter ||
+	    func == duk_bi_error_prototype_linenumber_getter || func == duk_bi_native_function_length ||
+	    func == duk_bi_native_function_name) {
+		return func;
+	}
+	return NULL;
+}
+
+/* Same for setters, which get the value as their only argument. */
+DUK_INTERNAL duk_c_function duk_call_direct_setter_func(duk_hthread *thr, duk_hobject *setter) {
+	duk_c_function func;
+
+	DUK_ASSERT(setter != NULL);
+
+	if (DUK_UNLIKELY(thr->callstack_curr == NULL || !DUK_HOBJECT_IS_NATFUNC(setter))) {
+		return NULL;
+	}
+	func = ((duk_hnatfunc *) setter)->func;
+	if (func == duk_bi_error_prototype_stack_setter || func == duk_bi_error_prototype_filename_setter ||
+	    func == duk_bi_error_prototype_linenumber_setter) {
+		return func;
+	}
+	return NULL;
+}
+
+DUK_INTERNAL void duk_call_natfunc_direct(duk_hthread *thr, duk_c_function func, duk_idx_t nargs) {
+	duk_size_t entry_valstack_bottom_byteoff;
+	duk_size_t entry_valstack_end_byteoff;
+	duk_idx_t idx_this;
+	duk_ret_t rc;
+
+	DUK_ASSERT(thr != NULL);
+	DUK_ASSERT(func != NULL);
+	DUK_ASSERT(nargs >= 0);
+	DUK_ASSERT(duk_get_top(thr) >= nargs + 1);
+	DUK_ASSERT(thr->callstack_curr != NULL); /* 'this' binding requires an activation */
+
+	entry_valstack_bottom_byteoff = (duk_size_t) ((duk_uint8_t *) thr->valstack_bottom - (duk_uint8_t *) thr->valstack);
+	entry_valstack_end_byteoff = (duk_size_t) ((duk_uint8_t *) thr->valstack_end - (duk_uint8_t *) thr->valstack);
+	idx_this = duk_get_top(thr) - (nargs + 1);
+
+	/* Same guaranteed reserve as for a native call with an activation. */
+	duk_valstack_grow_check_throw(thr,
+	                              (duk_size_t) ((duk_uint8_t *) thr->valstack_top - (duk_uint8_t *) thr->valstack) +
+	                                  sizeof(duk_tval) * (DUK_VALSTACK_API_ENTRY_MINIMUM + DUK_VALSTACK_INTERNAL_EXTRA));
+	thr->valstack_bottom = thr->valstack_top - nargs;
+
+	rc = func(thr);
+
+	if (rc == 0) {
+		duk_push_undefined(thr);
+	} else if (rc == 1) {
+		;
+	} else if (rc < 0) {
+		duk_error_throw_from_negative_rc(thr, rc);
+		DUK_WO_NORETURN(return;);
+	} else {
+		DUK_ERROR_TYPE(thr, DUK_STR_INVALID_CFUNC_RC);
+		DUK_WO_NORETURN(return;);
+	}
+
+	/* Value stack may have been resized, restore using offsets. */
+	thr->valstack_bottom = (duk_tval *) (void *) ((duk_uint8_t *) thr->valstack + entry_valstack_bottom_byteoff);
+	DUK_ASSERT(duk_get_top(thr) >= idx_this + 1);
+
+#if defined(DUK_USE_FASTINT)
+	DUK_TVAL_CHKFAST_INPLACE_FAST(thr->valstack_top - 1);
+#endif
+	duk_replace(thr, idx_this);
+	duk_set_top_unsafe(thr, idx_this + 1);
+
+	/* [ ... retval ] */
+
+	DUK_ASSERT((duk_uint8_t *) thr->valstack + entry_valstack_end_byteoff >= (duk_uint8_t *) thr->valstack_top);
+	thr->valstack_end = (duk_tval *) (void *) ((duk_uint8_t *) thr->valstack + entry_valstack_end_byteoff);
+}
+#endif /* DUK_USE_NATIVE_ACCESSOR_FASTPATH */
+
 /*
  *  duk_handle_safe_call(): make a "C protected call" within the
  *  current activation.
@@ -5955,6 +5955,56 @@ DUK_LOCAL void duk__parse_break_or_continue_stmt(duk_compiler_ctx *comp_ctx, duk
 	}
 }
 
+#if defined(DUK_USE_TAILCALL)
+/* Check whether the result of the CALL at 'pc_call' reaches 'pc_end' as the
+ * value of register 'rc_val' without any intervening side effects, i.e. the
+ * CALL is in tail position of a return expression.  Only temp-to-temp
+ * register copies and forward jumps are allowed on the path: this covers
+ * e.g. the branches of 'return x ? f() : g()' and 'return x || f()' which
+ * copy the call result into the expression's result temp.
+ */
+DUK_LOCAL duk_bool_t duk__is_tailcall_position(duk_compiler_ctx *comp_ctx,
+                                               duk_int_t pc_call,
+                                               duk_int_t pc_end,
+                                               duk_regconst_t rc_val) {
+	duk_instr_t ins;
+	duk_regconst_t reg_curr;
+	duk_int_t pc;
+	duk_int_t pc_target;
+
+	ins = duk__get_instr_ptr(comp_ctx, pc_call)->ins;
+	DUK_ASSERT((DUK_DEC_OP(ins) & ~0x0fU) == DUK_OP_CALL0);
+	reg_curr = (duk_regconst_t) DUK_DEC_BC(ins); /* call result replaces target */
+
+	pc = pc_call + 1;
+	while (pc < pc_end) {
+		ins = duk__get_instr_ptr(comp_ctx, pc)->ins;
+		switch (DUK_DEC_OP(ins)) {
+		case DUK_OP_LDREG:
+			if ((duk_regconst_t) DUK_DEC_BC(ins) != reg_curr ||
+			    !DUK__ISREG_TEMP(comp_ctx, (duk_regconst_t) DUK_DEC_A(ins))) {
+				return 0;
+			}
+			reg_curr = (duk_regconst_t) DUK_DEC_A(ins);
+			pc++;
+			break;
+		case DUK_OP_JUMP:
+			pc_target = pc + 1 + (duk_int_t) DUK_DEC_ABC(ins) - (duk_int_t) DUK_BC_JUMP_BIAS;
+			if (pc_target <= pc) {
+				/* Only forward jumps, also guarantees termination. */
+				return 0;
+			}
+			pc = pc_target;
+			break;
+		default:
+			return 0;
+		}
+	}
+
+	return (pc == pc_end && reg_curr == rc_val);
+}
+#endif /* DUK_USE_TAILCALL */
+
 DUK_LOCAL void duk__parse_return_stmt(duk_compiler_ctx *comp_ctx, duk_ivalue *res) {
 	duk_hthread *thr = comp_ctx->thr;
 	duk_regconst_t rc_val;
@@ -5987,7 +6037,7 @@ DUK_LOCAL void duk__parse_return_stmt(duk_compiler_ctx *comp_ctx, duk_ivalue *re
 		rc_val = duk__exprtop_toregconst(comp_ctx, res, DUK__BP_FOR_EXPR /*rbp_flags*/);
 		pc_after_expr = duk__get_current_pc(comp_ctx);
 
-		/* Tail call check: if last opcode emitted was CALL, and
+		/* Tail call check: if a CALL in tail position was emitted, and
 		 * the context allows it, add a tailcall flag to the CALL.
 		 * This doesn't guarantee that a tail call will be allowed at
 		 * runtime, so the RETURN must still be emitted.  (Duktape
@@ -6017,30 +6067,41 @@ DUK_LOCAL void duk__parse_return_stmt(duk_compiler_ctx *comp_ctx, duk_ivalue *re
 		 *
 		 * See: test-bug-comma-expr-gh131.js.
 		 *
+		 * A CALL need not be the last opcode: conditional and logical
+		 * expressions copy a branch's call result into a result temp
+		 * and jump to the end of the expression.  Every CALL whose
+		 * result flows into 'rc_val' through such copies and jumps
+		 * only is in tail position, see duk__is_tailcall_position().
+		 *
+		 * 'with' statements establish a catcher but don't catch errors
+		 * or run code on unwind; the tail call unwinds their lexical
+		 * environment like a return would.  Only try statements block
+		 * tail calls.
+		 *
 		 * The non-standard 'caller' property disables tail calls
 		 * because they pose some special cases which haven't been
 		 * fixed yet.
 		 */
 
 #if defined(DUK_USE_TAILCALL)
-		if (comp_ctx->curr_func.catch_depth == 0 && /* no catchers */
-		    pc_after_expr > pc_before_expr) { /* at least one opcode emitted */
+		if (comp_ctx->curr_func.catch_depth == comp_ctx->curr_func.with_depth && /* no try catchers */
+		    pc_after_expr > pc_before_expr && /* at least one opcode emitted */
+		    DUK__ISREG_TEMP(comp_ctx, rc_val) /* see above */) {
 			duk_compiler_instr *instr;
-			duk_instr_t ins;
-			duk_small_uint_t op;
-
-			instr = duk__get_instr_ptr(comp_ctx, pc_after_expr - 1);
-			DUK_ASSERT(instr != NULL);
-
-			ins = instr->ins;
-			op = (duk_small_uint_t) DUK_DEC_OP(ins);
-			if ((op & ~0x0fU) == DUK_OP_CALL0 && DUK__ISREG_TEMP(comp_ctx, rc_val) /* see above */) {
-				DUK_DDD(DUK_DDDPRINT("return statement detected a tail call opportunity: "
-				                     "catch depth is 0, duk__exprtop() emitted >= 1 instructions, "
-				                     "and last instruction is a CALL "
-				                     "-> change to TAILCALL"));
-				ins |= DUK_ENC_OP(DUK_BC_CALL_FLAG_TAILCALL);
-				instr->ins = ins;
+			duk_int_t pc;
+
+			for (pc = pc_before_expr; pc < pc_after_expr; pc++) {
+				instr = duk__get_instr_ptr(comp_ctx, pc);
+				DUK_ASSERT(instr != NULL);
+
+				if ((DUK_DEC_OP(instr->ins) & ~0x0fU) == DUK_OP_CALL0 &&
+				    duk__is_tailcall_position(comp_ctx, pc, pc_after_expr, rc_val)) {
+					DUK_DDD(DUK_DDDPRINT("return statement detected a tail call opportunity: "
+					                     "no try catchers, CALL at pc %ld is in tail position "
+					                     "-> change to TAILCALL",
+					                     (long) pc));
+					instr->ins |= DUK_ENC_OP(DUK_BC_CALL_FLAG_TAILCALL);
+				}
 			}
 		}
 #endif /* DUK_USE_TAILCALL */
@@ -151,6 +151,21 @@ DUK_LOCAL DUK_EXEC_ALWAYS_INLINE_PERF void duk__vm_arith_add(duk_hthread *thr,
 		return;
 	}
 
+#if !defined(DUK_USE_EXEC_PREFER_SIZE)
+	/* Fast path for string concatenation with a string or a number:
+	 * ToPrimitive() is a no-op for both so skip the coercion calls and
+	 * type checks of the slow path.
+	 */
+	if ((DUK_TVAL_IS_STRING(tv_x) && (DUK_TVAL_IS_STRING(tv_y) || DUK_TVAL_IS_NUMBER(tv_y))) ||
+	    (DUK_TVAL_IS_NUMBER(tv_x) && DUK_TVAL_IS_STRING(tv_y))) {
+		duk_push_tval(thr, tv_x);
+		duk_push_tval(thr, tv_y);
+		duk_concat_2(thr); /* [... s1 s2] -> [... s1+s2], side effects */
+		duk_replace(thr, (duk_idx_t) idx_z); /* side effects */
+		return;
+	}
+#endif /* DUK_USE_EXEC_PREFER_SIZE */
+
 	/*
 	 *  Slow path: potentially requires function calls for coercion
 	 */
@@ -2021,6 +2036,13 @@ DUK_LOCAL DUK_EXEC_NOINLINE_PERF DUK_COLD duk_small_uint_t duk__executor_interru
 
 	DUK_UNREF(fun);
 
+	/*
+	 *  Free a slice of a suspended refzero cascade (if enabled).  Running
+	 *  code that creates no new garbage still makes progress this way.
+	 */
+
+	DUK_HEAP_REFZERO_SLICE(thr->heap);
+
 #if defined(DUK_USE_EXEC_TIMEOUT_CHECK)
 	/*
 	 *  Execution timeout check
@@ -3688,6 +3710,28 @@ restart_execution:
 			DUK__SNEQ_BODY(DUK__CONSTP_B(ins), DUK__CONSTP_C(ins));
 #endif /* DUK_USE_EXEC_PREFER_SIZE */
 
+#if defined(DUK_USE_FASTINT) && !defined(DUK_USE_EXEC_PREFER_SIZE)
+/* Fastint comparison inline (typical for loop conditions), other types
+ * go through duk_js_compare_helper().  Fastints are never NaN so the
+ * result is simply (arg1 < arg2) with optional negation.
+ */
+#define DUK__COMPARE_BODY(arg1, arg2, flags) \
+	{ \
+		duk_tval *duk__tv1; \
+		duk_tval *duk__tv2; \
+		duk_bool_t tmp; \
+		duk__tv1 = (arg1); \
+		duk__tv2 = (arg2); \
+		if (DUK_LIKELY(DUK_TVAL_IS_FASTINT(duk__tv1) && DUK_TVAL_IS_FASTINT(duk__tv2))) { \
+			tmp = (DUK_TVAL_GET_FASTINT(duk__tv1) < DUK_TVAL_GET_FASTINT(duk__tv2)); \
+			tmp ^= ((flags) &DUK_COMPARE_FLAG_NEGATE); \
+		} else { \
+			tmp = duk_js_compare_helper(thr, duk__tv1, duk__tv2, (flags)); \
+		} \
+		DUK_ASSERT(tmp == 0 || tmp == 1); \
+		DUK__REPLACE_BOOL_A_BREAK(tmp); \
+	}
+#else
 #define DUK__COMPARE_BODY(arg1, arg2, flags) \
 	{ \
 		duk_bool_t tmp; \
@@ -3695,6 +3739,7 @@ restart_execution:
 		DUK_ASSERT(tmp == 0 || tmp == 1); \
 		DUK__REPLACE_BOOL_A_BREAK(tmp); \
 	}
+#endif
 #define DUK__GT_BODY(barg, carg) DUK__COMPARE_BODY((carg), (barg), 0)
 #define DUK__GE_BODY(barg, carg) DUK__COMPARE_BODY((barg), (carg), DUK_COMPARE_FLAG_EVAL_LEFT_FIRST | DUK_COMPARE_FLAG_NEGATE)
 #define DUK__LT_BODY(barg, carg) DUK__COMPARE_BODY((barg), (carg), DUK_COMPARE_FLAG_EVAL_LEFT_FIRST)
@@ -3755,27 +3800,35 @@ restart_execution:
 			DUK__LE_BODY(DUK__CONSTP_B(ins), DUK__CONSTP_C(ins));
 #endif /* DUK_USE_EXEC_PREFER_SIZE */
 
-		/* No size optimized variant at present for IF. */
+		/* No size optimized variant at present for IF.  Conditions are
+		 * most often booleans produced by comparison opcodes, so check
+		 * for a boolean inline before calling duk_js_toboolean().
+		 */
+#if defined(DUK_USE_EXEC_PREFER_SIZE)
+#define DUK__TOBOOLEAN(tv) duk_js_toboolean((tv))
+#else
+#define DUK__TOBOOLEAN(tv) (DUK_TVAL_IS_BOOLEAN((tv)) ? DUK_TVAL_GET_BOOLEAN((tv)) : duk_js_toboolean((tv)))
+#endif
 		case DUK_OP_IFTRUE_R: {
-			if (duk_js_toboolean(DUK__REGP_BC(ins)) != 0) {
+			if (DUK__TOBOOLEAN(DUK__REGP_BC(ins)) != 0) {
 				curr_pc++;
 			}
 			break;
 		}
 		case DUK_OP_IFTRUE_C: {
-			if (duk_js_toboolean(DUK__CONSTP_BC(ins)) != 0) {
+			if (DUK__TOBOOLEAN(DUK__CONSTP_BC(ins)) != 0) {
 				curr_pc++;
 			}
 			break;
 		}
 		case DUK_OP_IFFALSE_R: {
-			if (duk_js_toboolean(DUK__REGP_BC(ins)) == 0) {
+			if (DUK__TOBOOLEAN(DUK__REGP_BC(ins)) == 0) {
 				curr_pc++;
 			}
 			break;
 		}
 		case DUK_OP_IFFALSE_C: {
-			if (duk_js_toboolean(DUK__CONSTP_BC(ins)) == 0) {
+			if (DUK__TOBOOLEAN(DUK__CONSTP_BC(ins)) == 0) {
 				curr_pc++;
 			}
 			break;
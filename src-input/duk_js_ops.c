@@ -1022,11 +1022,24 @@ DUK_LOCAL duk_bool_t duk__js_instanceof_helper(duk_hthread *thr, duk_tval *tv_x,
 	 */
 	if (!skip_sym_check) {
 		if (duk_get_method_stridx(thr, -1, DUK_STRIDX_WELLKNOWN_SYMBOL_HAS_INSTANCE)) {
+			duk_hobject *h_method;
+
 			/* [ ... lhs rhs func ] */
-			duk_insert(thr, -3); /* -> [ ... func lhs rhs ] */
-			duk_swap_top(thr, -2); /* -> [ ... func rhs(this) lhs ] */
-			duk_call_method(thr, 1);
-			return duk_to_boolean_top_pop(thr);
+
+			/* The inherited Function.prototype[@@hasInstance] just
+			 * runs OrdinaryHasInstance() so it's not called: the
+			 * ordinary algorithm below gives the same result.
+			 */
+			h_method = duk_get_hobject(thr, -1);
+			if (h_method != NULL && DUK_HOBJECT_IS_NATFUNC(h_method) &&
+			    ((duk_hnatfunc *) h_method)->func == duk_bi_function_prototype_hasinstance) {
+				duk_pop_unsafe(thr); /* -> [ ... lhs rhs ] */
+			} else {
+				duk_insert(thr, -3); /* -> [ ... func lhs rhs ] */
+				duk_swap_top(thr, -2); /* -> [ ... func rhs(this) lhs ] */
+				duk_call_method(thr, 1);
+				return duk_to_boolean_top_pop(thr);
+			}
 		}
 	}
 #else
@@ -195,6 +195,17 @@ void duk_js_push_closure(duk_hthread *thr,
 	DUK_DD(DUK_DDPRINT("fun_temp heaphdr flags: 0x%08lx, fun_clos heaphdr flags: 0x%08lx",
 	                   (unsigned long) DUK_HEAPHDR_GET_FLAGS_RAW((duk_heaphdr *) fun_temp),
 	                   (unsigned long) DUK_HEAPHDR_GET_FLAGS_RAW((duk_heaphdr *) fun_clos)));
+#if defined(DUK_USE_ROM_OBJECTS)
+	/* Templates compiled into ROM are read-only, always reachable, and
+	 * non-extensible like all ROM objects; the closure is an ordinary
+	 * heap object.
+	 */
+	if (DUK_HEAPHDR_HAS_READONLY((duk_heaphdr *) fun_temp)) {
+		DUK_HEAPHDR_CLEAR_READONLY((duk_heaphdr *) fun_clos);
+		DUK_HEAPHDR_CLEAR_REACHABLE((duk_heaphdr *) fun_clos);
+		DUK_HOBJECT_SET_EXTENSIBLE(&fun_clos->obj);
+	}
+#endif
 
 	DUK_ASSERT(DUK_HOBJECT_HAS_EXTENSIBLE(&fun_clos->obj));
 	DUK_ASSERT(!DUK_HOBJECT_HAS_BOUNDFUNC(&fun_clos->obj));
@@ -685,6 +685,16 @@ typedef struct {
 		((nc_ctx)->digits[(preinc_idx) -1]) = (duk_uint8_t) (x); \
 	} while (0)
 
+/* Digit pairs "00" to "99" for radix 10 integer formatting, two digits
+ * per division.
+ */
+DUK_LOCAL const duk_uint8_t duk__numconv_digit_pairs[200 + 1] =
+	"0001020304050607080910111213141516171819"
+	"2021222324252627282930313233343536373839"
+	"4041424344454647484950515253545556575859"
+	"6061626364656667686970717273747576777879"
+	"8081828384858687888990919293949596979899";
+
 DUK_LOCAL duk_size_t duk__dragon4_format_uint32(duk_uint8_t *buf, duk_uint32_t x, duk_small_int_t radix) {
 	duk_uint8_t *p;
 	duk_size_t len;
@@ -699,6 +709,13 @@ DUK_LOCAL duk_size_t duk__dragon4_format_uint32(duk_uint8_t *buf, duk_uint32_t x
 	 * and use a memmove() to get them in the right place.
 	 */
 
+	if (radix == 10) {
+		p = duk_numconv_format_u32_backwards(buf + 32, x);
+		len = (duk_size_t) ((buf + 32) - p);
+		duk_memmove((void *) buf, (const void *) p, (size_t) len);
+		return len;
+	}
+
 	p = buf + 32;
 	for (;;) {
 		t = x / (duk_uint32_t) radix;
@@ -1778,6 +1795,86 @@ DUK_INTERNAL void duk_numconv_stringify(duk_hthread *thr, duk_small_int_t radix,
 	duk__numconv_stringify_raw(thr, radix, digits, flags);
 }
 
+/*
+ *  Fast integer formatting
+ *
+ *  Format an unsigned 32-bit integer in radix 10 backwards so that the
+ *  last digit goes to end[-1], using a digit pair table to halve the
+ *  number of divisions.  Returns a pointer to the first digit; at most
+ *  10 bytes are written.
+ */
+
+DUK_INTERNAL duk_uint8_t *duk_numconv_format_u32_backwards(duk_uint8_t *end, duk_uint32_t x) {
+	duk_uint8_t *p;
+	const duk_uint8_t *q;
+	duk_uint32_t t;
+
+	DUK_ASSERT(end != NULL);
+
+	p = end;
+	while (x >= 100U) {
+		t = x / 100U;
+		q = duk__numconv_digit_pairs + (x - t * 100U) * 2U;
+		x = t;
+		p -= 2;
+		p[0] = q[0];
+		p[1] = q[1];
+	}
+	if (x >= 10U) {
+		q = duk__numconv_digit_pairs + x * 2U;
+		p -= 2;
+		p[0] = q[0];
+		p[1] = q[1];
+	} else {
+		*(--p) = (duk_uint8_t) (DUK_ASC_0 + x);
+	}
+	return p;
+}
+
+/*
+ *  Fast integer formatting (signed)
+ *
+ *  Format a number into a caller supplied buffer (at least
+ *  DUK_NUMCONV_INTEGER_MAXLEN bytes) without pushing anything, for
+ *  callers which build a string directly.  Only integers in the 32-bit
+ *  range [-(2**32-1),2**32-1] are handled, matching the integer fast path
+ *  of duk_numconv_stringify() for radix 10; the output is identical to
+ *  ToString().  Returns the output length, or 0 if the value must be
+ *  formatted with duk_numconv_stringify().
+ */
+
+DUK_INTERNAL duk_small_uint_t duk_numconv_format_integer(duk_uint8_t *buf, duk_double_t x) {
+	duk_uint8_t tmp[DUK_NUMCONV_INTEGER_MAXLEN];
+	duk_uint8_t *p;
+	duk_uint8_t *q;
+	duk_uint32_t uval;
+	duk_bool_t neg;
+
+	DUK_ASSERT(buf != NULL);
+
+	neg = 0;
+	if (x < 0.0) {
+		x = -x;
+		neg = 1;
+	}
+	uval = duk_double_to_uint32_t(x);
+	if (!duk_double_equals((double) uval, x)) {
+		/* Fraction, out of range, NaN. */
+		return 0;
+	}
+
+	p = duk_numconv_format_u32_backwards(tmp + sizeof(tmp), uval);
+	if (neg) {
+		*(--p) = (duk_uint8_t) DUK_ASC_MINUS;
+	}
+
+	q = buf;
+	while (p < tmp + sizeof(tmp)) {
+		*q++ = *p++;
+	}
+	return (duk_small_uint_t) (q - buf);
+}
+
 /*
  *  Exposed string-to-number API
  *
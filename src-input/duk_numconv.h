@@ -94,6 +94,11 @@
  */
 #define DUK_S2N_FLAG_ALLOW_AUTO_BIN_INT (1U << 14)
 
+/* Maximum output length of duk_numconv_format_integer(): sign and 10
+ * digits.
+ */
+#define DUK_NUMCONV_INTEGER_MAXLEN 11
+
 /*
  *  Prototypes
  */
@@ -102,6 +107,8 @@ DUK_INTERNAL_DECL void duk_numconv_stringify(duk_hthread *thr,
                                              duk_small_int_t radix,
                                              duk_small_int_t digits,
                                              duk_small_uint_t flags);
+DUK_INTERNAL_DECL duk_uint8_t *duk_numconv_format_u32_backwards(duk_uint8_t *end, duk_uint32_t x);
+DUK_INTERNAL_DECL duk_small_uint_t duk_numconv_format_integer(duk_uint8_t *buf, duk_double_t x);
 DUK_INTERNAL_DECL void duk_numconv_parse(duk_hthread *thr, duk_small_int_t radix, duk_small_uint_t flags);
 
 #endif /* DUK_NUMCONV_H_INCLUDED */
@@ -542,7 +542,104 @@
 		} \
 	} while (0)
 
-/* XXX: no optimized variants yet */
+/* Faster alternatives for the typed setters: avoid a temporary copy of
+ * tvptr_dst and only DECREF the previous value if it actually needs it.
+ * Value stack and register writes in the executor mostly overwrite
+ * primitive values (numbers, booleans, undefined), so the common case
+ * involves no refcount traffic at all.
+ */
+#define DUK__TVAL_SET_PRIM_UPDREF_ALT1(thr, tvptr_dst, setcall, decref) \
+	do { \
+		duk_tval *tv__dst; \
+		duk_heaphdr *h__obj; \
+		tv__dst = (tvptr_dst); \
+		if (DUK_TVAL_NEEDS_REFCOUNT_UPDATE(tv__dst)) { \
+			h__obj = DUK_TVAL_GET_HEAPHDR(tv__dst); \
+			DUK_ASSERT(h__obj != NULL); \
+			setcall; \
+			decref((thr), h__obj); /* side effects */ \
+		} else { \
+			setcall; \
+		} \
+	} while (0)
+
+#define DUK_TVAL_SET_UNDEFINED_UPDREF_ALT1(thr, tvptr_dst) \
+	DUK__TVAL_SET_PRIM_UPDREF_ALT1((thr), (tvptr_dst), DUK_TVAL_SET_UNDEFINED(tv__dst), DUK_HEAPHDR_DECREF_FAST)
+#define DUK_TVAL_SET_UNDEFINED_UPDREF_NORZ_ALT1(thr, tvptr_dst) \
+	DUK__TVAL_SET_PRIM_UPDREF_ALT1((thr), (tvptr_dst), DUK_TVAL_SET_UNDEFINED(tv__dst), DUK_HEAPHDR_DECREF_NORZ_FAST)
+#define DUK_TVAL_SET_UNUSED_UPDREF_ALT1(thr, tvptr_dst) \
+	DUK__TVAL_SET_PRIM_UPDREF_ALT1((thr), (tvptr_dst), DUK_TVAL_SET_UNUSED(tv__dst), DUK_HEAPHDR_DECREF_FAST)
+#define DUK_TVAL_SET_NULL_UPDREF_ALT1(thr, tvptr_dst) \
+	DUK__TVAL_SET_PRIM_UPDREF_ALT1((thr), (tvptr_dst), DUK_TVAL_SET_NULL(tv__dst), DUK_HEAPHDR_DECREF_FAST)
+#define DUK_TVAL_SET_BOOLEAN_UPDREF_ALT1(thr, tvptr_dst, newval) \
+	DUK__TVAL_SET_PRIM_UPDREF_ALT1((thr), (tvptr_dst), DUK_TVAL_SET_BOOLEAN(tv__dst, (newval)), DUK_HEAPHDR_DECREF_FAST)
+#define DUK_TVAL_SET_NUMBER_UPDREF_ALT1(thr, tvptr_dst, newval) \
+	DUK__TVAL_SET_PRIM_UPDREF_ALT1((thr), (tvptr_dst), DUK_TVAL_SET_NUMBER(tv__dst, (newval)), DUK_HEAPHDR_DECREF_FAST)
+#define DUK_TVAL_SET_NUMBER_CHKFAST_UPDREF_ALT1(thr, tvptr_dst, newval) \
+	DUK__TVAL_SET_PRIM_UPDREF_ALT1((thr), \
+	                               (tvptr_dst), \
+	                               DUK_TVAL_SET_NUMBER_CHKFAST_FAST(tv__dst, (newval)), \
+	                               DUK_HEAPHDR_DECREF_FAST)
+#define DUK_TVAL_SET_DOUBLE_UPDREF_ALT1(thr, tvptr_dst, newval) \
+	DUK__TVAL_SET_PRIM_UPDREF_ALT1((thr), (tvptr_dst), DUK_TVAL_SET_DOUBLE(tv__dst, (newval)), DUK_HEAPHDR_DECREF_FAST)
+#define DUK_TVAL_SET_NAN_UPDREF_ALT1(thr, tvptr_dst) \
+	DUK__TVAL_SET_PRIM_UPDREF_ALT1((thr), (tvptr_dst), DUK_TVAL_SET_NAN(tv__dst), DUK_HEAPHDR_DECREF_FAST)
+#if defined(DUK_USE_FASTINT)
+#define DUK_TVAL_SET_I48_UPDREF_ALT1(thr, tvptr_dst, newval) \
+	DUK__TVAL_SET_PRIM_UPDREF_ALT1((thr), (tvptr_dst), DUK_TVAL_SET_I48(tv__dst, (newval)), DUK_HEAPHDR_DECREF_FAST)
+#define DUK_TVAL_SET_I32_UPDREF_ALT1(thr, tvptr_dst, newval) \
+	DUK__TVAL_SET_PRIM_UPDREF_ALT1((thr), (tvptr_dst), DUK_TVAL_SET_I32(tv__dst, (newval)), DUK_HEAPHDR_DECREF_FAST)
+#define DUK_TVAL_SET_U32_UPDREF_ALT1(thr, tvptr_dst, newval) \
+	DUK__TVAL_SET_PRIM_UPDREF_ALT1((thr), (tvptr_dst), DUK_TVAL_SET_U32(tv__dst, (newval)), DUK_HEAPHDR_DECREF_FAST)
+#endif /* DUK_USE_FASTINT */
+
+/* For heap allocated new values INCREF the new value first: the old and
+ * new value may be the same object and the DECREF must not free it.
+ */
+#define DUK_TVAL_SET_STRING_UPDREF_ALT1(thr, tvptr_dst, newval) \
+	do { \
+		duk_hstring *h__new = (newval); \
+		DUK_HEAPHDR_INCREF_FAST((thr), (duk_heaphdr *) h__new); \
+		DUK__TVAL_SET_PRIM_UPDREF_ALT1((thr), (tvptr_dst), DUK_TVAL_SET_STRING(tv__dst, h__new), DUK_HEAPHDR_DECREF_FAST); \
+	} while (0)
+#define DUK_TVAL_SET_OBJECT_UPDREF_ALT1(thr, tvptr_dst, newval) \
+	do { \
+		duk_hobject *h__new = (newval); \
+		DUK_HEAPHDR_INCREF_FAST((thr), (duk_heaphdr *) h__new); \
+		DUK__TVAL_SET_PRIM_UPDREF_ALT1((thr), (tvptr_dst), DUK_TVAL_SET_OBJECT(tv__dst, h__new), DUK_HEAPHDR_DECREF_FAST); \
+	} while (0)
+
+#if defined(DUK_USE_FAST_REFCOUNT_DEFAULT)
+/* Optimized for speed. */
+#define DUK_TVAL_SET_UNDEFINED_UPDREF      DUK_TVAL_SET_UNDEFINED_UPDREF_ALT1
+#define DUK_TVAL_SET_UNDEFINED_UPDREF_NORZ DUK_TVAL_SET_UNDEFINED_UPDREF_NORZ_ALT1
+#define DUK_TVAL_SET_UNUSED_UPDREF         DUK_TVAL_SET_UNUSED_UPDREF_ALT1
+#define DUK_TVAL_SET_NULL_UPDREF           DUK_TVAL_SET_NULL_UPDREF_ALT1
+#define DUK_TVAL_SET_BOOLEAN_UPDREF        DUK_TVAL_SET_BOOLEAN_UPDREF_ALT1
+#define DUK_TVAL_SET_NUMBER_UPDREF         DUK_TVAL_SET_NUMBER_UPDREF_ALT1
+#define DUK_TVAL_SET_NUMBER_CHKFAST_UPDREF DUK_TVAL_SET_NUMBER_CHKFAST_UPDREF_ALT1
+#define DUK_TVAL_SET_DOUBLE_UPDREF         DUK_TVAL_SET_DOUBLE_UPDREF_ALT1
+#define DUK_TVAL_SET_NAN_UPDREF            DUK_TVAL_SET_NAN_UPDREF_ALT1
+#if defined(DUK_USE_FASTINT)
+#define DUK_TVAL_SET_I48_UPDREF DUK_TVAL_SET_I48_UPDREF_ALT1
+#define DUK_TVAL_SET_I32_UPDREF DUK_TVAL_SET_I32_UPDREF_ALT1
+#define DUK_TVAL_SET_U32_UPDREF DUK_TVAL_SET_U32_UPDREF_ALT1
+#else
+#define DUK_TVAL_SET_I48_UPDREF DUK_TVAL_SET_DOUBLE_CAST_UPDREF /* XXX: fast int-to-double */
+#define DUK_TVAL_SET_I32_UPDREF DUK_TVAL_SET_DOUBLE_CAST_UPDREF
+#define DUK_TVAL_SET_U32_UPDREF DUK_TVAL_SET_DOUBLE_CAST_UPDREF
+#endif /* DUK_USE_FASTINT */
+#define DUK_TVAL_SET_FASTINT_UPDREF   DUK_TVAL_SET_I48_UPDREF /* convenience */
+#define DUK_TVAL_SET_LIGHTFUNC_UPDREF DUK_TVAL_SET_LIGHTFUNC_UPDREF_ALT0
+#define DUK_TVAL_SET_STRING_UPDREF    DUK_TVAL_SET_STRING_UPDREF_ALT1
+#define DUK_TVAL_SET_OBJECT_UPDREF    DUK_TVAL_SET_OBJECT_UPDREF_ALT1
+#define DUK_TVAL_SET_BUFFER_UPDREF    DUK_TVAL_SET_BUFFER_UPDREF_ALT0
+#define DUK_TVAL_SET_POINTER_UPDREF   DUK_TVAL_SET_POINTER_UPDREF_ALT0
+#define DUK_TVAL_SET_TVAL_UPDREF      DUK_TVAL_SET_TVAL_UPDREF_ALT1
+#define DUK_TVAL_SET_TVAL_UPDREF_FAST DUK_TVAL_SET_TVAL_UPDREF_ALT1
+#define DUK_TVAL_SET_TVAL_UPDREF_SLOW DUK_TVAL_SET_TVAL_UPDREF_ALT0
+#else /* DUK_USE_FAST_REFCOUNT_DEFAULT */
+/* Optimized for size. */
 #define DUK_TVAL_SET_UNDEFINED_UPDREF      DUK_TVAL_SET_UNDEFINED_UPDREF_ALT0
 #define DUK_TVAL_SET_UNDEFINED_UPDREF_NORZ DUK_TVAL_SET_UNDEFINED_UPDREF_NORZ_ALT0
 #define DUK_TVAL_SET_UNUSED_UPDREF         DUK_TVAL_SET_UNUSED_UPDREF_ALT0
@@ -567,18 +664,10 @@
 #define DUK_TVAL_SET_OBJECT_UPDREF    DUK_TVAL_SET_OBJECT_UPDREF_ALT0
 #define DUK_TVAL_SET_BUFFER_UPDREF    DUK_TVAL_SET_BUFFER_UPDREF_ALT0
 #define DUK_TVAL_SET_POINTER_UPDREF   DUK_TVAL_SET_POINTER_UPDREF_ALT0
-
-#if defined(DUK_USE_FAST_REFCOUNT_DEFAULT)
-/* Optimized for speed. */
-#define DUK_TVAL_SET_TVAL_UPDREF      DUK_TVAL_SET_TVAL_UPDREF_ALT1
-#define DUK_TVAL_SET_TVAL_UPDREF_FAST DUK_TVAL_SET_TVAL_UPDREF_ALT1
-#define DUK_TVAL_SET_TVAL_UPDREF_SLOW DUK_TVAL_SET_TVAL_UPDREF_ALT0
-#else
-/* Optimized for size. */
 #define DUK_TVAL_SET_TVAL_UPDREF      DUK_TVAL_SET_TVAL_UPDREF_ALT0
 #define DUK_TVAL_SET_TVAL_UPDREF_FAST DUK_TVAL_SET_TVAL_UPDREF_ALT0
 #define DUK_TVAL_SET_TVAL_UPDREF_SLOW DUK_TVAL_SET_TVAL_UPDREF_ALT0
-#endif
+#endif /* DUK_USE_FAST_REFCOUNT_DEFAULT */
 
 #else /* DUK_USE_REFERENCE_COUNTING */
 
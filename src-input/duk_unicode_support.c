@@ -1041,6 +1041,25 @@ duk_codepoint_t duk__case_transform_helper(duk_hthread *thr,
 		/* XXX: turkish / azeri, lowercase rules */
 	}
 
+#if defined(DUK_USE_CASECONV_LOOKUP)
+	/* Direct lookup for the most common non-ASCII blocks.  A zero entry
+	 * marks a 1:n conversion which is left to the bitstream.
+	 */
+	if (cp >= DUK_CASECONV_LOOKUP_START && cp < DUK_CASECONV_LOOKUP_END) {
+		duk_codepoint_t tmp_cp;
+
+		if (uppercase) {
+			tmp_cp = (duk_codepoint_t) duk_unicode_caseconv_uc_lookup[cp - DUK_CASECONV_LOOKUP_START];
+		} else {
+			tmp_cp = (duk_codepoint_t) duk_unicode_caseconv_lc_lookup[cp - DUK_CASECONV_LOOKUP_START];
+		}
+		if (tmp_cp != 0) {
+			cp = tmp_cp;
+			goto singlechar;
+		}
+	}
+#endif
+
 	/* 1:1 or special conversions, but not locale/context specific: script generated rules */
 	duk_memzero(&bd_ctx, sizeof(bd_ctx));
 	if (uppercase) {
@@ -1069,23 +1088,72 @@ singlechar:
  *  Replace valstack top with case converted version.
  */
 
+/* Case convert an ASCII-only byte range.  Written without branches in the
+ * loop body so that compilers can vectorize it.
+ */
+DUK_LOCAL void duk__case_convert_ascii(duk_uint8_t *dst, const duk_uint8_t *src, duk_size_t len, duk_bool_t uppercase) {
+	duk_uint8_t first;
+	duk_uint8_t x;
+	duk_size_t i;
+
+	first = (duk_uint8_t) (uppercase ? DUK_ASC_LC_A : DUK_ASC_UC_A);
+	for (i = 0; i < len; i++) {
+		x = src[i];
+		dst[i] = (duk_uint8_t) (x ^ ((duk_uint8_t) (x - first) < 26U ? 0x20U : 0x00U));
+	}
+}
+
 DUK_INTERNAL void duk_unicode_case_convert_string(duk_hthread *thr, duk_bool_t uppercase) {
 	duk_hstring *h_input;
 	duk_bufwriter_ctx bw_alloc;
 	duk_bufwriter_ctx *bw;
 	const duk_uint8_t *p, *p_start, *p_end;
 	duk_codepoint_t prev, curr, next;
+	duk_uint8_t first;
+	duk_bool_t need_change;
 
 	h_input = duk_require_hstring(thr, -1); /* Accept symbols. */
 	DUK_ASSERT(h_input != NULL);
 
+	p_start = (const duk_uint8_t *) duk_hstring_get_data(h_input);
+	p_end = p_start + duk_hstring_get_bytelen(h_input);
+
+	/* Fast path for ASCII input, which has no context sensitive rules:
+	 * if nothing changes the input string is the result as is, otherwise
+	 * convert with a simple byte loop.  Non-ASCII input (which includes
+	 * symbols) is handled below.
+	 */
+	first = (duk_uint8_t) (uppercase ? DUK_ASC_LC_A : DUK_ASC_UC_A);
+	need_change = 0;
+	for (p = p_start; p < p_end; p++) {
+		if (*p >= 0x80U) {
+			break;
+		}
+		if ((duk_uint8_t) (*p - first) < 26U) {
+			need_change = 1;
+		}
+	}
+	if (p == p_end) {
+		duk_uint8_t *buf;
+
+		if (!need_change) {
+			return;
+		}
+		buf = (duk_uint8_t *) duk_push_fixed_buffer_nozero(thr, (duk_size_t) (p_end - p_start));
+		/* Buffer allocation may trigger GC but h_input is reachable
+		 * and string data doesn't move.
+		 */
+		duk__case_convert_ascii(buf, p_start, (duk_size_t) (p_end - p_start), uppercase);
+		(void) duk_buffer_to_string(thr, -1); /* Safe, output is ASCII. */
+		duk_remove_m2(thr);
+		return;
+	}
+
 	bw = &bw_alloc;
 	DUK_BW_INIT_PUSHBUF(thr, bw, duk_hstring_get_bytelen(h_input));
 
 	/* [ ... input buffer ] */
 
-	p_start = (const duk_uint8_t *) duk_hstring_get_data(h_input);
-	p_end = p_start + duk_hstring_get_bytelen(h_input);
 	p = p_start;
 
 	prev = -1;
@@ -1097,7 +1165,11 @@ DUK_INTERNAL void duk_unicode_case_convert_string(duk_hthread *thr, duk_bool_t u
 		curr = next;
 		next = -1;
 		if (p < p_end) {
-			next = (duk_codepoint_t) duk_unicode_decode_xutf8_checked(thr, &p, p_start, p_end);
+			if (*p < 0x80U) {
+				next = (duk_codepoint_t) *p++;
+			} else {
+				next = (duk_codepoint_t) duk_unicode_decode_xutf8_checked(thr, &p, p_start, p_end);
+			}
 		} else {
 			/* end of input and last char has been processed */
 			if (curr < 0) {
@@ -55,6 +55,12 @@
 
 #include "duk_unicode_caseconv.c"
 
+#if defined(DUK_USE_CASECONV_LOOKUP)
+/* duk_unicode_caseconv_uc_lookup[] */
+/* duk_unicode_caseconv_lc_lookup[] */
+#include "duk_unicode_caseconv_lookup.c"
+#endif
+
 #if defined(DUK_USE_REGEXP_CANON_WORKAROUND)
 #include "duk_unicode_re_canon_lookup.c"
 #endif
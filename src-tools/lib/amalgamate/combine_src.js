@@ -50,6 +50,7 @@ const { readFileUtf8, pathJoin, basename, fileExists } = require('../util/fs');
 const { createBareObject } = require('../util/bare');
 const { stripLastNewline, normalizeNewlines } = require('../util/string_util');
 const { cStrEncode } = require('../util/cquote');
+const { annotateHotCold } = require('./hotcold');
 
 function Line(fileName, lineNo, data) {
     this.fileName = basename(fileName);
@@ -228,16 +229,27 @@ function combineSources(args) {
     var includeExcluded = args.includeExcluded || [];
     var prologueFileName = args.prologueFileName;
     var lineDirectives = !!args.lineDirectives;
+    var hotColdProfile = args.hotColdProfile;
 
     var comb = new CombineSource(includePaths, includeExcluded);
     includePaths.forEach((inc) => { comb.includePaths.push(inc); });
 
-    // Read input files, add automatic #undefs.
+    // Read input files, add automatic #undefs and optional hot/cold
+    // function annotations.
+    var hotColdCounts = { hot: 0, cold: 0 };
     var files = sourceFiles.map((fn) => {
         let res = readFile(fn);
         comb.addAutomaticUndefs(res);
+        if (hotColdProfile) {
+            let counts = annotateHotCold(res, hotColdProfile);
+            hotColdCounts.hot += counts.hot;
+            hotColdCounts.cold += counts.cold;
+        }
         return res;
     });
+    if (hotColdProfile) {
+        console.log('hot/cold profile: annotated ' + hotColdCounts.hot + ' hot and ' + hotColdCounts.cold + ' cold functions');
+    }
 
     // Combine and return.
     var combinedSource, metadata;
@@ -0,0 +1,97 @@
+/*
+ *  Hot/cold function annotation for the combined source.
+ *
+ *  Function definitions listed as hot in a hot/cold profile (by default
+ *  src-input/hotcold.yaml) get a DUK_HOT attribute and functions listed
+ *  as cold, or defined in a cold source file, get a DUK_COLD attribute.
+ *  With GCC these map to __attribute__((hot)) and __attribute__((cold))
+ *  which place the functions into .text.hot and .text.unlikely so that the
+ *  executor, property access, and other fast path code is packed together
+ *  (fewer i-cache and iTLB misses), and branches leading to cold functions
+ *  are predicted not taken.  This gives part of the benefit of PGO without
+ *  users having to run it themselves.
+ *
+ *  Functions are annotated in place rather than reordered in the combined
+ *  source: reordering would break static functions defined before use and
+ *  #if nesting, while section placement achieves the layout at link time.
+ *  Only the attribute is inserted into an existing line so line numbers
+ *  (and #line directives) are unaffected.
+ */
+
+'use strict';
+
+const { readFileYaml, basename } = require('../util/fs');
+const { createBareObject } = require('../util/bare');
+
+// Start of a function definition (or declaration) at column 0, e.g.:
+//   DUK_INTERNAL duk_bool_t duk_hobject_foo(duk_hthread *thr,
+//   DUK_LOCAL DUK_NOINLINE void duk__bar(void) {
+// Data definitions are excluded by rejecting '=' before the name.
+const reFuncStart = /^(DUK_INTERNAL|DUK_LOCAL|DUK_EXTERNAL)(\s+)[^=;(]*?\b([A-Za-z_]\w*)\(/;
+
+// Max number of lines scanned for the opening brace of a definition.
+const maxSignatureLines = 8;
+
+function loadHotColdProfile(fn) {
+    var doc = readFileYaml(fn);
+    var res = {
+        hot: createBareObject({}),
+        cold: createBareObject({}),
+        coldFiles: createBareObject({})
+    };
+    (doc.hot || []).forEach((name) => { res.hot[name] = true; });
+    (doc.cold || []).forEach((name) => { res.cold[name] = true; });
+    (doc.cold_files || []).forEach((name) => { res.coldFiles[name] = true; });
+    return res;
+}
+exports.loadHotColdProfile = loadHotColdProfile;
+
+// Check whether the signature starting at lines[idx] is a definition, and
+// whether it already has an explicit hot/cold attribute.
+function scanSignature(lines, idx) {
+    for (let i = idx; i < Math.min(lines.length, idx + maxSignatureLines); i++) {
+        let data = lines[i].data;
+        if (/\bDUK_(HOT|COLD)\b/.test(data)) {
+            return { definition: false };
+        }
+        if (data.indexOf(';') >= 0) {
+            return { definition: false };
+        }
+        if (/\{\s*$/.test(data)) {
+            return { definition: true };
+        }
+    }
+    return { definition: false };
+}
+
+// Annotate function definitions of a parsed source file in place, return
+// counts of annotated functions.
+function annotateHotCold(file, profile) {
+    var fileIsCold = !!profile.coldFiles[basename(file.fileNameFull)];
+    var counts = { hot: 0, cold: 0 };
+
+    file.lines.forEach((line, idx) => {
+        let m = reFuncStart.exec(line.data);
+        if (!m) {
+            return;
+        }
+        let name = m[3];
+        let attr;
+        if (profile.hot[name]) {
+            attr = 'DUK_HOT';
+        } else if (profile.cold[name] || fileIsCold) {
+            attr = 'DUK_COLD';
+        } else {
+            return;
+        }
+        if (!scanSignature(file.lines, idx).definition) {
+            return;
+        }
+        console.debug('hot/cold annotation: ' + name + ' -> ' + attr);
+        line.data = m[1] + m[2] + attr + ' ' + line.data.substring(m[1].length + m[2].length);
+        counts[attr === 'DUK_HOT' ? 'hot' : 'cold']++;
+    });
+
+    return counts;
+}
+exports.annotateHotCold = annotateHotCold;
@@ -36,6 +36,7 @@ function emitObjectTypedefs(genc) {
     genc.emitLine('typedef struct duk_romarr duk_romarr; struct duk_romarr { duk_harray hdr; };');
     genc.emitLine('typedef struct duk_romfun duk_romfun; struct duk_romfun { duk_hnatfunc hdr; };');
     genc.emitLine('typedef struct duk_romobjenv duk_romobjenv; struct duk_romobjenv { duk_hobjenv hdr; };');
+    genc.emitLine('typedef struct duk_romcompfun duk_romcompfun; struct duk_romcompfun { duk_hcompfunc hdr; };');
 }
 
 function emitObjectInitializersPtrComp(genc) {
@@ -71,6 +72,21 @@ function emitObjectInitializersNoPtrComp(genc) {
 
     genc.emitLine('#define DUK__ROMOBJENV_INIT(heaphdr_flags,refcount,props,props_enc16,iproto,iproto_enc16,esize,enext,asize,hsize,target,has_this) ' +
                   ' { { { { (heaphdr_flags), DUK__REFCINIT((refcount)), NULL, NULL }, (duk_uint8_t *) DUK_LOSE_CONST(props), (duk_hobject *) DUK_LOSE_CONST(iproto), (esize), (enext), (asize), (hsize) }, (duk_hobject *) DUK_LOSE_CONST(target), (has_this) } }');
+
+    // Compiled functions: lex_env and var_env are left NULL and default
+    // to the global environment at runtime.  Compiled functions and their
+    // fixed data buffers are only supported without pointer compression
+    // and DUK_USE_BUFLEN16, so there are no ptrcomp variants.
+    genc.emitLine('#if defined(DUK_USE_DEBUGGER_SUPPORT)');
+    genc.emitLine('#define DUK__ROMCOMPFUN_INIT(heaphdr_flags,refcount,props,props_enc16,iproto,iproto_enc16,esize,enext,asize,hsize,data,funcs,bytecode,nregs,nargs,start_line,end_line) ' +
+                  ' { { { { (heaphdr_flags), DUK__REFCINIT((refcount)), NULL, NULL }, (duk_uint8_t *) DUK_LOSE_CONST(props), (duk_hobject *) DUK_LOSE_CONST(iproto), (esize), (enext), (asize), (hsize) }, (duk_hbuffer *) DUK_LOSE_CONST(data), (duk_hobject **) DUK_LOSE_CONST(funcs), (duk_instr_t *) DUK_LOSE_CONST(bytecode), NULL, NULL, (nregs), (nargs), (start_line), (end_line) } }');
+    genc.emitLine('#else');
+    genc.emitLine('#define DUK__ROMCOMPFUN_INIT(heaphdr_flags,refcount,props,props_enc16,iproto,iproto_enc16,esize,enext,asize,hsize,data,funcs,bytecode,nregs,nargs,start_line,end_line) ' +
+                  ' { { { { (heaphdr_flags), DUK__REFCINIT((refcount)), NULL, NULL }, (duk_uint8_t *) DUK_LOSE_CONST(props), (duk_hobject *) DUK_LOSE_CONST(iproto), (esize), (enext), (asize), (hsize) }, (duk_hbuffer *) DUK_LOSE_CONST(data), (duk_hobject **) DUK_LOSE_CONST(funcs), (duk_instr_t *) DUK_LOSE_CONST(bytecode), NULL, NULL, (nregs), (nargs) } }');
+    genc.emitLine('#endif');
+
+    genc.emitLine('#define DUK__ROMBUF_INIT(heaphdr_flags,refcount,size) ' +
+                  ' { { { { (heaphdr_flags), DUK__REFCINIT((refcount)), NULL, NULL }, (size) } } }');
 }
 
 function emitObjectInitializers(genc) {
@@ -195,6 +211,11 @@ function emitTvalStructs(genc) {
     genc.emitLine('#else  /* DUK_USE_PACKED_TVAL */');
     emitTvalStructsUnpackedTval(genc);
     genc.emitLine('#endif  /* DUK_USE_PACKED_TVAL */');
+
+    // Buffer values are heap pointers like objects, only the tag differs.
+    // Fastints have the same representation as numbers.
+    genc.emitLine('typedef duk_rom_tval_object duk_rom_tval_buffer;');
+    genc.emitLine('typedef duk_rom_tval_number duk_rom_tval_fastint;');
 }
 
 function emitDoubleInitializer(genc) {
@@ -210,6 +231,15 @@ function emitDoubleInitializer(genc) {
     genc.emitLine('#else');
     genc.emitLine('#error invalid endianness defines');
     genc.emitLine('#endif');
+
+    // Same for 64-bit integers, needed for unpacked fastints.
+    genc.emitLine('#if defined(DUK_USE_INTEGER_LE)');
+    genc.emitLine('#define DUK__I64BYTES(a,b,c,d,e,f,g,h) { (h), (g), (f), (e), (d), (c), (b), (a) }');
+    genc.emitLine('#elif defined(DUK_USE_INTEGER_BE)');
+    genc.emitLine('#define DUK__I64BYTES(a,b,c,d,e,f,g,h) { (a), (b), (c), (d), (e), (f), (g), (h) }');
+    genc.emitLine('#else');
+    genc.emitLine('#error invalid endianness defines');
+    genc.emitLine('#endif');
     genc.emitLine('');
 }
 
@@ -222,6 +252,7 @@ function emitTvalInitializersPackedTval(genc) {
     genc.emitLine('#define DUK__TVAL_BOOLEAN(bval) { 0, (DUK_TAG_BOOLEAN << 16) + (bval) }');
     genc.emitLine('#define DUK__TVAL_OBJECT(ptr) { (const void *) (ptr), (DUK_TAG_OBJECT << 16) }');
     genc.emitLine('#define DUK__TVAL_STRING(ptr) { (const void *) (ptr), (DUK_TAG_STRING << 16) }');
+    genc.emitLine('#define DUK__TVAL_BUFFER(ptr) { (const void *) (ptr), (DUK_TAG_BUFFER << 16) }');
     genc.emitLine('#elif defined(DUK_USE_DOUBLE_BE)');
     genc.emitLine('#define DUK__TVAL_UNDEFINED() { (DUK_TAG_UNDEFINED << 16), (const void *) NULL }');
     genc.emitLine('#define DUK__TVAL_NULL() { (DUK_TAG_NULL << 16), (const void *) NULL }');
@@ -229,6 +260,7 @@ function emitTvalInitializersPackedTval(genc) {
     genc.emitLine('#define DUK__TVAL_BOOLEAN(bval) { (DUK_TAG_BOOLEAN << 16) + (bval), 0 }');
     genc.emitLine('#define DUK__TVAL_OBJECT(ptr) { (DUK_TAG_OBJECT << 16), (const void *) (ptr) }');
     genc.emitLine('#define DUK__TVAL_STRING(ptr) { (DUK_TAG_STRING << 16), (const void *) (ptr) }');
+    genc.emitLine('#define DUK__TVAL_BUFFER(ptr) { (DUK_TAG_BUFFER << 16), (const void *) (ptr) }');
     genc.emitLine('#elif defined(DUK_USE_DOUBLE_ME)');
     genc.emitLine('#define DUK__TVAL_UNDEFINED() { (DUK_TAG_UNDEFINED << 16), (const void *) NULL }');
     genc.emitLine('#define DUK__TVAL_NULL() { (DUK_TAG_NULL << 16), (const void *) NULL }');
@@ -236,10 +268,16 @@ function emitTvalInitializersPackedTval(genc) {
     genc.emitLine('#define DUK__TVAL_BOOLEAN(bval) { (DUK_TAG_BOOLEAN << 16) + (bval), 0 }');
     genc.emitLine('#define DUK__TVAL_OBJECT(ptr) { (DUK_TAG_OBJECT << 16), (const void *) (ptr) }');
     genc.emitLine('#define DUK__TVAL_STRING(ptr) { (DUK_TAG_STRING << 16), (const void *) (ptr) }');
+    genc.emitLine('#define DUK__TVAL_BUFFER(ptr) { (DUK_TAG_BUFFER << 16), (const void *) (ptr) }');
     genc.emitLine('#else');
     genc.emitLine('#error invalid endianness defines');
     genc.emitLine('#endif');
     genc.emitLine('#define DUK__TVAL_ACCESSOR(getter,setter) { (const duk_hobject *) (getter), (const duk_hobject *) (setter) }');
+    genc.emitLine('#if defined(DUK_USE_FASTINT)');
+    genc.emitLine('#define DUK__TVAL_FASTINT(ival,dblbytes,fastbytes,i64bytes) { fastbytes }');
+    genc.emitLine('#else');
+    genc.emitLine('#define DUK__TVAL_FASTINT(ival,dblbytes,fastbytes,i64bytes) { dblbytes }');
+    genc.emitLine('#endif');
 }
 
 function emitTvalInitializersUnpackedTval(genc) {
@@ -251,8 +289,14 @@ function emitTvalInitializersUnpackedTval(genc) {
     genc.emitLine('#define DUK__TVAL_BOOLEAN(bval) { .t=DUK_TAG_BOOLEAN, .v_extra=0, .v={ .i=(bval) } }');
     genc.emitLine('#define DUK__TVAL_OBJECT(ptr) { .t=DUK_TAG_OBJECT, .v_extra=0, .v={ .hobject=(duk_hobject *) DUK_LOSE_CONST(ptr) } }');
     genc.emitLine('#define DUK__TVAL_STRING(ptr) { .t=DUK_TAG_STRING, .v_extra=0, .v={ .hstring=(duk_hstring *) DUK_LOSE_CONST(ptr) } }');
+    genc.emitLine('#define DUK__TVAL_BUFFER(ptr) { .t=DUK_TAG_BUFFER, .v_extra=0, .v={ .hbuffer=(duk_hbuffer *) DUK_LOSE_CONST(ptr) } }');
     genc.emitLine('#define DUK__TVAL_LIGHTFUNC(func,flags) { .t=DUK_TAG_LIGHTFUNC, .v_extra=(flags), .v={ .lightfunc=(duk_rom_funcptr) (func) } }');
     genc.emitLine('#define DUK__TVAL_ACCESSOR(getter,setter) { .a={ .get=(duk_hobject *) DUK_LOSE_CONST(getter), .set=(duk_hobject *) DUK_LOSE_CONST(setter) } }');
+    genc.emitLine('#if defined(DUK_USE_FASTINT)');
+    genc.emitLine('#define DUK__TVAL_FASTINT(ival,dblbytes,fastbytes,i64bytes) { .t=DUK_TAG_FASTINT, .v_extra=0, .v={ .fi=(ival) } }');
+    genc.emitLine('#else');
+    genc.emitLine('#define DUK__TVAL_FASTINT(ival,dblbytes,fastbytes,i64bytes) { .t=DUK_TAG_NUMBER, .v_extra=0, .v={ .bytes=dblbytes } }');
+    genc.emitLine('#endif');
 
     genc.emitLine('#else  /* DUK_USE_UNION_INITIALIZERS */');
 
@@ -260,14 +304,21 @@ function emitTvalInitializersUnpackedTval(genc) {
     genc.emitLine('#define DUK__TVAL_UNDEFINED() { DUK_TAG_UNDEFINED, 0, {0,0,0,0,0,0,0,0} }');
     genc.emitLine('#define DUK__TVAL_NULL() { DUK_TAG_NULL, 0, {0,0,0,0,0,0,0,0} }');
     genc.emitLine('#define DUK__TVAL_BOOLEAN(bval) { DUK_TAG_BOOLEAN, 0, (bval), 0 }');
+    genc.emitLine('#if defined(DUK_USE_FASTINT)');
+    genc.emitLine('#define DUK__TVAL_FASTINT(ival,dblbytes,fastbytes,i64bytes) { DUK_TAG_FASTINT, 0, i64bytes }');
+    genc.emitLine('#else');
+    genc.emitLine('#define DUK__TVAL_FASTINT(ival,dblbytes,fastbytes,i64bytes) { DUK_TAG_NUMBER, 0, dblbytes }');
+    genc.emitLine('#endif');
     genc.emitLine('#if defined(DUK__32BITPTR)');
     genc.emitLine('#define DUK__TVAL_OBJECT(ptr) { DUK_TAG_OBJECT, 0, (const duk_heaphdr *) (ptr), (const void *) NULL }');
     genc.emitLine('#define DUK__TVAL_STRING(ptr) { DUK_TAG_STRING, 0, (const duk_heaphdr *) (ptr), (const void *) NULL }');
+    genc.emitLine('#define DUK__TVAL_BUFFER(ptr) { DUK_TAG_BUFFER, 0, (const duk_heaphdr *) (ptr), (const void *) NULL }');
     genc.emitLine('#define DUK__TVAL_LIGHTFUNC(func,flags) { DUK_TAG_LIGHTFUNC, (flags), (duk_rom_funcptr) (func), (const void *) NULL }');
     genc.emitLine('#define DUK__TVAL_ACCESSOR(getter,setter) { (const duk_hobject *) (getter), (const duk_hobject *) (setter), (const void *) NULL, (const void *) NULL }');
     genc.emitLine('#else  /* DUK__32BITPTR */');
     genc.emitLine('#define DUK__TVAL_OBJECT(ptr) { DUK_TAG_OBJECT, 0, (const duk_heaphdr *) (ptr) }');
     genc.emitLine('#define DUK__TVAL_STRING(ptr) { DUK_TAG_STRING, 0, (const duk_heaphdr *) (ptr) }');
+    genc.emitLine('#define DUK__TVAL_BUFFER(ptr) { DUK_TAG_BUFFER, 0, (const duk_heaphdr *) (ptr) }');
     genc.emitLine('#define DUK__TVAL_LIGHTFUNC(func,flags) { DUK_TAG_LIGHTFUNC, (flags), (duk_rom_funcptr) (func) }');
     genc.emitLine('#define DUK__TVAL_ACCESSOR(getter,setter) { (const duk_hobject *) (getter), (const duk_hobject *) (setter) }');
     genc.emitLine('#endif  /* DUK__32BITPTR */');
@@ -306,6 +357,24 @@ function getDoubleBytesInitializer(val) {
 function getTvalNumberInitializer(val) {
     return 'DUK__TVAL_NUMBER(' + getDoubleBytesInitializer(val) + ')';
 }
+exports.getTvalNumberInitializer = getTvalNumberInitializer;
+
+// Fastint initializer, falls back to a plain number without fastint
+// support.  Only unsigned 32-bit values are needed (like DUK_TVAL_SET_U32()).
+function getTvalFastintInitializer(val) {
+    assert(typeof val === 'number' && val >= 0 && val <= 0xffffffff && Math.floor(val) === val);
+    var low = [ val >>> 24, (val >>> 16) & 0xff, (val >>> 8) & 0xff, val & 0xff ].map((t) => '' + t + 'U');
+    var fastBytes = 'DUK__DBLBYTES(' + [ '0xffU', '0xf1U', '0U', '0U' ].concat(low).join(',') + ')';  // DUK_TAG_FASTINT << 48
+    var i64Bytes = 'DUK__I64BYTES(' + [ '0U', '0U', '0U', '0U' ].concat(low).join(',') + ')';
+    return 'DUK__TVAL_FASTINT(' + val + 'UL,' + getDoubleBytesInitializer(numberToDoubleHex(val)) + ',' + fastBytes + ',' + i64Bytes + ')';
+}
+
+// C symbol name for a fixed ROM buffer.
+function getRomBufferName(id) {
+    assert(typeof id === 'string' && /^[A-Za-z0-9_]+$/.test(id), 'buffer id must be a valid C identifier part');
+    return 'duk_buf_' + id;
+}
+exports.getRomBufferName = getRomBufferName;
 
 // Get an initializer type and initializer literal for a specified value
 // (expressed in YAML metadata format).  The types and initializers depend
@@ -340,6 +409,11 @@ function getValueInitializer(meta, p, biStrMap, biObjMap) {
             initLit = getTvalNumberInitializer(v.bytes);
             break;
         }
+        case 'fastint': {
+            initType = 'duk_rom_tval_fastint';
+            initLit = getTvalFastintInitializer(v.value);
+            break;
+        }
         case 'undefined': {
             initType = 'duk_rom_tval_undefined';
             initLit = 'DUK__TVAL_UNDEFINED()';
@@ -357,6 +431,13 @@ function getValueInitializer(meta, p, biStrMap, biObjMap) {
             initLit = 'DUK__TVAL_OBJECT(&' + obj + ')';
             break;
         }
+        case 'buffer': {
+            // Fixed ROM buffers are only created internally, e.g. for
+            // compiled function _Pc2line, see emitRomBuffers().
+            initType = 'duk_rom_tval_buffer';
+            initLit = 'DUK__TVAL_BUFFER(&' + getRomBufferName(v.id) + ')';
+            break;
+        }
         case 'accessor': {
             let getterRef = 'NULL';
             let setterRef = 'NULL';
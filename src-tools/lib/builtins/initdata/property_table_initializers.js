@@ -8,6 +8,21 @@ const { getValueInitializerType, getValueInitializerLiteral } = require('./objec
 const { propAttrLookup } = require('./property_attributes.js');
 const { assert } = require('../../util/assert');
 
+// Objects with array items (e.g. compiled function _Formals) have no entry
+// part properties.  With a zero entry part size the array part is at the
+// start of the property table in all layouts, so the property table is
+// just a sequence of duk_tvals.
+function getArrayItemCount(o) {
+    var numItems = (o.array_items ? o.array_items.length : 0);
+    assert(numItems === 0 || o.properties.length === 0, 'array items only supported without properties');
+    return numItems;
+}
+exports.getArrayItemCount = getArrayItemCount;
+
+function getArrayItemProperties(o) {
+    return (o.array_items || []).map((v) => ({ value: v }));
+}
+
 function emitPropertyTableStructs(genc, meta, objs, biStrMap, biObjMap) {
     // Emit property table structs.  These are very complex because
     // property count *and* individual property type affect the fields
@@ -21,6 +36,21 @@ function emitPropertyTableStructs(genc, meta, objs, biStrMap, biObjMap) {
     // but there'd be very few of them so it's more straightforward to
     // not reuse the structs.
 
+    objs.forEach((o, idx) => {
+        var parts = [];
+        if (getArrayItemCount(o) === 0) {
+            return;
+        }
+
+        parts.push('typedef struct duk_romprops_' + idx + ' duk_romprops_' + idx + '; ');
+        parts.push('struct duk_romprops_' + idx + ' { ');
+        getArrayItemProperties(o).forEach((p, itemIdx) => {
+            parts.push(getValueInitializerType(meta, p, biStrMap, biObjMap) + ' item' + itemIdx + '; ');
+        });
+        parts.push('};');
+        genc.emitLine(parts.join(''));
+    });
+
     genc.emitLine('#if defined(DUK_USE_HOBJECT_LAYOUT_1)');
 
     objs.forEach((o, idx) => {
@@ -111,7 +141,7 @@ function emitPropertyTableForwardDeclarations(genc, meta, objs, compressRomPtr)
     // Also pointer compress them.
 
     objs.forEach((o, idx) => {
-        let numProps = o.properties.length;
+        let numProps = o.properties.length + getArrayItemCount(o);
         if (numProps === 0) {
             return;
         }
@@ -183,6 +213,16 @@ function emitPropertyTableDefinitions(genc, meta, objs, biStrMap, biObjMap) {
         }
     }
 
+    objs.forEach((o, idx) => {
+        var initList;
+        if (getArrayItemCount(o) === 0) {
+            return;
+        }
+        initList = getArrayItemProperties(o).map((p) => getValueInitializerLiteral(meta, p, biStrMap, biObjMap));
+        genc.emitLine('DUK_EXTERNAL const duk_romprops_' + idx + ' duk_prop_' + idx +
+                      ' = {' + initList.join(',') + '};');
+    });
+
     genc.emitLine('#if defined(DUK_USE_HOBJECT_LAYOUT_1)');
     objs.forEach((o, idx) => {
         emitInitializer(idx, o, 1);
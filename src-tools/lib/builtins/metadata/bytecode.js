@@ -0,0 +1,186 @@
+/*
+ *  Expand 'bytecode' property values into compiled function objects.
+ *
+ *  A 'bytecode' value refers to a file created using duk_dump_function()
+ *  (e.g. 'duk -c'), and is decoded at configure time into a tree of ROM
+ *  compiled function objects: the function itself, its inner function
+ *  templates, and their _Varmap and _Formals helper objects.  Bytecode,
+ *  constants, and strings then live in the read-only data section and no
+ *  compilation or allocation is needed for the code at runtime.
+ */
+
+'use strict';
+
+const { readFile } = require('../../extbindings/fileio');
+const { decodeBytecodeUint8Array } = require('../../bytecode/decode');
+const { walkObjects } = require('./util');
+const { arrayToBstr } = require('../../util/bstr');
+const { hexEncode } = require('../../util/hex');
+const { assert } = require('../../util/assert');
+const { classToNumber } = require('../classnames');
+
+// duk_hobject flags in DUK_HEAPHDR_USER_FLAG() order, must match duk_hobject.h.
+const hobjectFlagNames = [
+    'DUK_HOBJECT_FLAG_EXTENSIBLE',
+    'DUK_HOBJECT_FLAG_CONSTRUCTABLE',
+    'DUK_HOBJECT_FLAG_CALLABLE',
+    'DUK_HOBJECT_FLAG_BOUNDFUNC',
+    'DUK_HOBJECT_FLAG_COMPFUNC',
+    'DUK_HOBJECT_FLAG_NATFUNC',
+    'DUK_HOBJECT_FLAG_BUFOBJ',
+    'DUK_HOBJECT_FLAG_FASTREFS',
+    'DUK_HOBJECT_FLAG_ARRAY_PART',
+    'DUK_HOBJECT_FLAG_STRICT',
+    'DUK_HOBJECT_FLAG_NOTAIL',
+    'DUK_HOBJECT_FLAG_NEWENV',
+    'DUK_HOBJECT_FLAG_NAMEBINDING',
+    'DUK_HOBJECT_FLAG_CREATEARGS',
+    'DUK_HOBJECT_FLAG_HAVE_FINALIZER',
+    'DUK_HOBJECT_FLAG_EXOTIC_ARRAY',
+    'DUK_HOBJECT_FLAG_EXOTIC_STRINGOBJ',
+    'DUK_HOBJECT_FLAG_EXOTIC_ARGUMENTS',
+    'DUK_HOBJECT_FLAG_EXOTIC_PROXYOBJ',
+    'DUK_HOBJECT_FLAG_SPECIAL_CALL'
+];
+const USER_FLAGS_START = 7;  // DUK_HEAPHDR_FLAGS_USER_START
+const CLASS_BASE = USER_FLAGS_START + 20;  // DUK_HOBJECT_FLAG_CLASS_BASE
+const CLASS_MASK = 0x1f;
+
+var bytecodeObjCounter = 0;
+
+// Convert dumped duk_hobject flags into flag define names.  Heap flags
+// (bits below USER_FLAGS_START) are runtime state and are ignored.
+// EXTENSIBLE is dropped because ROM objects must be non-extensible.
+function decodeFunctionFlags(flags) {
+    var res = [];
+    var classNumber = (flags >>> CLASS_BASE) & CLASS_MASK;
+
+    if (classNumber !== classToNumber('Function')) {
+        throw new TypeError('unexpected class number in bytecode function flags: ' + classNumber);
+    }
+    hobjectFlagNames.forEach((name, idx) => {
+        if ((flags >>> (USER_FLAGS_START + idx)) & 1) {
+            if (name !== 'DUK_HOBJECT_FLAG_EXTENSIBLE') {
+                res.push(name);
+            }
+        }
+    });
+    if (res.indexOf('DUK_HOBJECT_FLAG_COMPFUNC') < 0) {
+        throw new TypeError('bytecode function flags are missing DUK_HOBJECT_FLAG_COMPFUNC');
+    }
+    return res;
+}
+
+function decodedString(x) {
+    assert(x.type === 'string' || x.type === 'buffer');
+    return arrayToBstr(x.value);
+}
+
+// Create objects for a decoded function and its inner functions, return
+// the object ID of the function.
+function createFunctionObjects(func, id, newObjs) {
+    var props = [];
+    var funcIds = [];
+
+    func.functions.forEach((inner, idx) => {
+        funcIds.push(createFunctionObjects(inner, id + '_' + idx, newObjs));
+    });
+
+    // Register numbers in _Varmap are expected to be fastints when
+    // DUK_USE_FASTINT is enabled.
+    var varmapId = id + '_varmap';
+    newObjs.push({
+        id: varmapId,
+        class: 'Object',
+        properties: func.varmap.map((v) => ({ key: decodedString(v.name), value: { type: 'fastint', value: v.reg }, attributes: '' })),
+        auto_generated: true
+    });
+
+    var formalsId;
+    if (func.formals !== null) {
+        formalsId = id + '_formals';
+        newObjs.push({
+            id: formalsId,
+            class: 'Array',
+            properties: [],
+            array_items: func.formals.map((v) => decodedString(v.name)),
+            auto_generated: true
+        });
+    }
+
+    props.push({ key: 'length', value: func.length, attributes: '' });
+    props.push({ key: 'name', value: decodedString(func.name), attributes: '', present_if: 'DUK_USE_FUNC_NAME_PROPERTY' });
+    props.push({ key: 'fileName', value: decodedString(func.fileName), attributes: '', present_if: 'DUK_USE_FUNC_FILENAME_PROPERTY' });
+    props.push({
+        key: '\x82Pc2line',
+        value: { type: 'buffer', id: id + '_pc2line', bytes: hexEncode(new Uint8Array(func.pc2line.value)) },
+        attributes: '',
+        present_if: 'DUK_USE_PC2LINE'
+    });
+    props.push({ key: '\x82Varmap', value: { type: 'object', id: varmapId }, attributes: '' });
+    if (formalsId !== void 0) {
+        props.push({ key: '\x82Formals', value: { type: 'object', id: formalsId }, attributes: '' });
+    }
+
+    newObjs.push({
+        id: id,
+        class: 'Function',
+        internal_prototype: 'bi_function_prototype',
+        callable: true,
+        nargs: func.nargs,
+        compfunc: {
+            flags: decodeFunctionFlags(func.compfuncFlags),
+            nregs: func.nregs,
+            nargs: func.nargs,
+            start_line: func.startLine,
+            end_line: func.endLine,
+            bytecode: func.instructions.map((v) => v.ins),
+            constants: func.constants.map((c) => {
+                if (c.type === 'string') {
+                    return { type: 'string', value: decodedString(c) };
+                } else {
+                    assert(c.type === 'double');
+                    return { type: 'double', bytes: hexEncode(new Uint8Array(c.value)) };
+                }
+            }),
+            functions: funcIds
+        },
+        properties: props,
+        auto_generated: true
+    });
+
+    return id;
+}
+
+// Replace { type: 'bytecode', filename: '...' } property values with
+// references to generated compiled function objects.  Compiled functions
+// can only be expressed in ROM init data, so for RAM builds the property
+// is dropped.
+function expandBytecodeValues(meta, romBuild) {
+    var newObjs = [];
+
+    walkObjects(meta, (o) => {
+        o.properties = o.properties.filter((p) => {
+            let v = p.value;
+            if (!(typeof v === 'object' && v !== null && v.type === 'bytecode')) {
+                return true;
+            }
+            if (typeof v.filename !== 'string') {
+                throw new TypeError('bytecode value for ' + o.id + '/' + p.key + ' is missing filename');
+            }
+            if (!romBuild) {
+                console.log('bytecode property ' + p.key + ' of ' + o.id + ' requires ROM built-ins, dropped from RAM init data');
+                return false;
+            }
+
+            console.debug('expand bytecode property ' + p.key + ' of ' + o.id + ' from ' + v.filename);
+            let decoded = decodeBytecodeUint8Array(readFile(v.filename));
+            let funcId = createFunctionObjects(decoded.func, 'bytecode_' + (bytecodeObjCounter++), newObjs);
+            p.value = { type: 'object', id: funcId };
+            return true;
+        });
+    });
+
+    meta.objects = meta.objects.concat(newObjs);
+}
+exports.expandBytecodeValues = expandBytecodeValues;
@@ -9,6 +9,7 @@ const {
     walkStrings,
     walkObjectProperties,
     walkObjectsAndProperties,
+    walkObjectValueStrings,
     propDefault
 } = require('./util');
 const { createBareObject } = require('../../util/bare');
@@ -63,6 +64,9 @@ function removeUnreachableObjectsAndStrings(meta) {
                 return;
             }
             markId(o.internal_prototype);
+            if (o.compfunc) {
+                o.compfunc.functions.forEach(markId);
+            }
             walkObjectProperties(o, (p) => {
                 // Shorthand has been normalized so no need
                 // to support it here.
@@ -106,7 +110,11 @@ function removeUnreachableObjectsAndStrings(meta) {
 
     var reachableStrings = {};
     var numDeletedStrings = 0;
-    walkObjectsAndProperties(meta, null, (p, o) => {
+    walkObjectsAndProperties(meta, (o) => {
+        walkObjectValueStrings(o, (str) => {
+            reachableStrings[str] = true;
+        });
+    }, (p, o) => {
         void o;
         reachableStrings[p.key] = true;
         if (typeof p.value === 'string') {
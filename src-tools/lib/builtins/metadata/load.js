@@ -20,6 +20,7 @@ const {
     walkObjects,
     walkObjectsAndProperties,
     walkObjectProperties,
+    walkObjectValueStrings,
     walkStrings,
     findPropertyByKey,
     findPropertyIndexByKey,
@@ -28,6 +29,7 @@ const {
     findObjectAndIndexById,
 } = require('./util');
 const { normalizeMetadata } = require('./normalize');
+const { expandBytecodeValues } = require('./bytecode');
 const { validateFinalMetadata } = require('./validate');
 const { markStridxStringsReachable, markBidxObjectsReachable, removeUnreachableObjectsAndStrings } = require('./gc');
 const { jsonDeepClone } = require('../../util/clone');
@@ -736,7 +738,15 @@ function addMissingRomStrings(meta) {
 
     // For ROM builtins all the strings must be in the strings list,
     // so scan objects for any strings not explicitly listed in metadata.
-    walkObjectsAndProperties(meta, null, (p, o) => {
+    walkObjectsAndProperties(meta, (o) => {
+        walkObjectValueStrings(o, (str) => {
+            if (!strsHave[str]) {
+                console.debug('add missing object value string: ' + str);
+                meta.strings.push({ str: str, _auto_add_ref: true, _force_reachable: 'rom_missing' });
+                strsHave[str] = true;
+            }
+        });
+    }, (p, o) => {
         void o;
         var key = p.key;
         if (!strsHave[key]) {
@@ -823,6 +833,7 @@ function loadMetadata(args) {
         console.log('merging user built-in metadata file ' + fn);
         let userMeta = parseYaml(readFileUtf8(fn));
         normalizeMetadata(userMeta, activeOpts);
+        expandBytecodeValues(userMeta, romBuild);
         mergeMetadata(meta, userMeta);
     });
 
@@ -38,6 +38,9 @@ function prettyValue(x) {
             let dv = new DataView(u8.buffer);
             return '<' + x.bytes + '> ' + dv.getFloat64(0);
         }
+        case 'buffer': {
+            return 'buffer ' + x.id + ' (' + (x.bytes.length / 2) + ' bytes)';
+        }
         }
     }
 
@@ -76,6 +79,12 @@ function prettyObjectEntry(o) {
     if (o.native) {
         extra.push('native ' + o.native);
     }
+    if (o.compfunc) {
+        extra.push('compfunc ' + o.compfunc.bytecode.length + ' instructions');
+    }
+    if (o.array_items) {
+        extra.push('array_items ' + o.array_items.length);
+    }
     if (o.varargs !== void 0) {
         extra.push('varargs');
     }
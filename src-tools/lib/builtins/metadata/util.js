@@ -69,6 +69,22 @@ function walkObjectProperties(o, cb) {
 }
 exports.walkObjectProperties = walkObjectProperties;
 
+// Walk strings referenced by an object outside its properties: array items
+// and compiled function constants.
+function walkObjectValueStrings(o, cb) {
+    (o.array_items || []).forEach((v) => {
+        cb(v);
+    });
+    if (o.compfunc) {
+        o.compfunc.constants.forEach((c) => {
+            if (c.type === 'string') {
+                cb(c.value);
+            }
+        });
+    }
+}
+exports.walkObjectValueStrings = walkObjectValueStrings;
+
 function walkStrings(meta, cb) {
     for (let s of meta.strings) {
         if (cb) {
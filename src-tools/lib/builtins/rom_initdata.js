@@ -9,10 +9,12 @@ const { propDefault, walkObjectsAndProperties } = require('./metadata/util');
 const { createBareObject } = require('../util/bare');
 const { assert } = require('../util/assert');
 const { jsonStringifyAscii } = require('../util/json');
+const { hexDecode } = require('../util/hex');
 const { classToNumber } = require('./classnames');
 const { emitStringHashMacros, emitStringInitMacro, emitStringDeclarations, emitStringInitializer } = require('./initdata/string_initializers');
 const { createRomStringTable } = require('./initdata/stringtable');
-const { emitPropertyTableStructs, emitPropertyTableForwardDeclarations, emitPropertyTableDefinitions } = require('./initdata/property_table_initializers');
+const { emitPropertyTableStructs, emitPropertyTableForwardDeclarations, emitPropertyTableDefinitions, getArrayItemCount } = require('./initdata/property_table_initializers');
+const { getValueInitializerType, getValueInitializerLiteral, getTvalNumberInitializer, getRomBufferName } = require('./initdata/object_initializers');
 const { emitPropAttrDefines } = require('./initdata/property_attributes');
 
 // Base value for compressed ROM pointers, used range is [ROMPTR_FIRST,0xffff].
@@ -144,7 +146,9 @@ function emitStringsHeader(genc, meta) {
 exports.emitStringsHeader = emitStringsHeader;
 
 function getObjectStructName(o) {
-    if (propDefault(o, 'callable', false)) {
+    if (o.compfunc) {
+        return 'duk_romcompfun';
+    } else if (propDefault(o, 'callable', false)) {
         return 'duk_romfun';
     } else if (o.class === 'Array') {
         return 'duk_romarr';
@@ -167,6 +171,98 @@ function emitObjectForwardDeclarations(genc, meta, objs) {
     });
 }
 
+// Walk fixed buffer values referenced by object properties.
+function walkRomBuffers(meta, cb) {
+    walkObjectsAndProperties(meta, null, (p, o) => {
+        void o;
+        let v = p.value;
+        if (typeof v === 'object' && v !== null && v.type === 'buffer') {
+            cb(v);
+        }
+    });
+}
+
+function hasCompiledFunctionsOrBuffers(meta) {
+    var res = false;
+    meta.objects.forEach((o) => {
+        if (o.compfunc) {
+            res = true;
+        }
+    });
+    walkRomBuffers(meta, () => {
+        res = true;
+    });
+    return res;
+}
+
+function emitRomBuffers(genc, meta) {
+    // Fixed buffers are a duk_hbuffer_fixed header followed directly by
+    // the buffer data.  There are no user visible ROM buffers, they're
+    // only used for internal values like compiled function _Pc2line.
+
+    walkRomBuffers(meta, (v) => {
+        let name = getRomBufferName(v.id);
+        let structName = 'duk_rombuf_' + v.id;
+        let data = [... hexDecode(v.bytes)];
+        let flags = [ 'DUK_HTYPE_BUFFER', 'DUK_HEAPHDR_FLAG_READONLY', 'DUK_HEAPHDR_FLAG_REACHABLE' ];
+
+        genc.emitLine('typedef struct ' + structName + ' ' + structName + '; ' +
+                      'struct ' + structName + ' { duk_hbuffer_fixed hdr; ' +
+                      (data.length > 0 ? 'duk_uint8_t data[' + data.length + ']; ' : '') + '};');
+        genc.emitLine('DUK_INTERNAL const ' + structName + ' ' + name + ' = { ' +
+                      'DUK__ROMBUF_INIT(' + flags.join('|') + ',1,' + data.length + ')' +
+                      (data.length > 0 ? ', { ' + data.map((x) => String(x) + 'U').join(',') + ' }' : '') + ' };');
+    });
+}
+
+function emitCompiledFunctionData(genc, meta, objs, biStrMap, biObjMap) {
+    // Each compiled function has a fixed buffer containing its constants,
+    // inner function template pointers, and bytecode.  The layout must
+    // match duk_hcompfunc: constants start right after the fixed buffer
+    // header, and 'funcs' and 'bytecode' point inside the same buffer.
+
+    objs.forEach((o, idx) => {
+        let cf = o.compfunc;
+        if (!cf) {
+            return;
+        }
+        let numConsts = cf.constants.length;
+        let numFuncs = cf.functions.length;
+        let numCode = cf.bytecode.length;
+        let types = [];
+        let inits = [];
+        let flags = [ 'DUK_HTYPE_BUFFER', 'DUK_HEAPHDR_FLAG_READONLY', 'DUK_HEAPHDR_FLAG_REACHABLE' ];
+
+        assert(numCode > 0);
+        cf.constants.forEach((c, cidx) => {
+            if (c.type === 'string') {
+                types.push(getValueInitializerType(meta, { value: c.value }, biStrMap, biObjMap) + ' c' + cidx + '; ');
+                inits.push(getValueInitializerLiteral(meta, { value: c.value }, biStrMap, biObjMap));
+            } else {
+                assert(c.type === 'double');
+                types.push('duk_rom_tval_number c' + cidx + '; ');
+                inits.push(getTvalNumberInitializer(c.bytes));
+            }
+        });
+        if (numFuncs > 0) {
+            types.push('const duk_hobject *funcs[' + numFuncs + ']; ');
+            inits.push('{ ' + cf.functions.map((id) => '(const duk_hobject *) &' + biObjMap[id]).join(',') + ' }');
+        }
+        types.push('duk_instr_t code[' + numCode + ']; ');
+        inits.push('{ ' + cf.bytecode.map((ins) => '0x' + ins.toString(16) + 'UL').join(',') + ' }');
+
+        // Buffer size excludes any trailing struct padding so that the
+        // bytecode end is computed correctly.
+        let size = '(' + numConsts + ' * sizeof(duk_tval) + ' + numFuncs + ' * sizeof(duk_hobject *) + ' +
+                   numCode + ' * sizeof(duk_instr_t))';
+
+        genc.emitLine('typedef struct duk_romfundata_' + idx + ' duk_romfundata_' + idx + '; ' +
+                      'struct duk_romfundata_' + idx + ' { duk_hbuffer_fixed hdr; ' + types.join('') + '};');
+        genc.emitLine('DUK_INTERNAL const duk_romfundata_' + idx + ' duk_fundata_' + idx + ' = { ' +
+                      ['DUK__ROMBUF_INIT(' + flags.join('|') + ',1,' + size + ')'].concat(inits).join(', ') + ' };');
+    });
+}
+
 function emitObjectDefinitions(genc, meta, objs, biObjMap, compressRomPtr) {
     // Define objects, reference property tables.  Objects will be
     // logically non-extensible so also leave their extensible flag
@@ -175,7 +271,9 @@ function emitObjectDefinitions(genc, meta, objs, biObjMap, compressRomPtr) {
 
     objs.forEach((o, idx) => {
         var numProps = o.properties.length;
-        var isFunc = propDefault(o, 'callable', false);
+        var numItems = getArrayItemCount(o);
+        var isCompFunc = (typeof o.compfunc === 'object');
+        var isFunc = propDefault(o, 'callable', false) && !isCompFunc;
         var structName = getObjectStructName(o);
         var parts = [];
         var flags = [];
@@ -190,15 +288,24 @@ function emitObjectDefinitions(genc, meta, objs, biObjMap, compressRomPtr) {
             flags.push('DUK_HOBJECT_FLAG_STRICT');
             flags.push('DUK_HOBJECT_FLAG_NEWENV');
         }
-        if (propDefault(o, 'callable', false)) {
+        if (isCompFunc) {
+            // Compiled function flags come from the bytecode, and include
+            // DUK_HOBJECT_FLAG_CALLABLE.
+            o.compfunc.flags.forEach((f) => {
+                flags.push(f);
+            });
+        } else if (propDefault(o, 'callable', false)) {
             flags.push('DUK_HOBJECT_FLAG_CALLABLE');
-         }
+        }
         if (propDefault(o, 'constructable', false)) {
             flags.push('DUK_HOBJECT_FLAG_CONSTRUCTABLE');
         }
         if (o.class === 'Array') {
             flags.push('DUK_HOBJECT_FLAG_EXOTIC_ARRAY');
         }
+        if (numItems > 0) {
+            flags.push('DUK_HOBJECT_FLAG_ARRAY_PART');
+        }
         if (propDefault(o, 'special_call', false)) {
             flags.push('DUK_HOBJECT_FLAG_SPECIAL_CALL');
         }
@@ -206,7 +313,7 @@ function emitObjectDefinitions(genc, meta, objs, biObjMap, compressRomPtr) {
 
         var refcount = 1;  // refcount is faked to be always 1
 
-        var props = (numProps > 0 ? '&duk_prop_' + idx : 'NULL');
+        var props = (numProps + numItems > 0 ? '&duk_prop_' + idx : 'NULL');
         var propsEnc16 = compressRomPtr(props);
 
         var iproto = (typeof o.internal_prototype !== 'undefined' ? '&' + biObjMap[o.internal_prototype] : 'NULL');
@@ -214,7 +321,7 @@ function emitObjectDefinitions(genc, meta, objs, biObjMap, compressRomPtr) {
 
         var eSize = numProps;
         var eNext = eSize;
-        var aSize = 0;  // never an array part for now
+        var aSize = numItems;  // array part only for array items, e.g. _Formals
         var hSize = 0;  // never a hash for now; not appropriate for perf relevant builds
 
         var nativeFunc;
@@ -240,19 +347,26 @@ function emitObjectDefinitions(genc, meta, objs, biObjMap, compressRomPtr) {
             magic = '0';
         }
 
-        assert(aSize === 0);
+        assert(aSize === 0 || eSize === 0);
         assert(hSize === 0);
 
         var sharedFields = [
             flags.join('|'), refcount, props, propsEnc16,
             iproto, iprotoEnc16, eSize, eNext, aSize, hSize
         ];
-        if (isFunc) {
+        if (isCompFunc) {
+            let cf = o.compfunc;
+            let funcs = (cf.functions.length > 0 ? '&duk_fundata_' + idx + '.funcs[0]' : '&duk_fundata_' + idx + '.code[0]');
+            parts.push('DUK__ROMCOMPFUN_INIT(' + sharedFields.concat([
+                '&duk_fundata_' + idx, funcs, '&duk_fundata_' + idx + '.code[0]',
+                cf.nregs, cf.nargs, cf.start_line + 'UL', cf.end_line + 'UL'
+            ]).join(',') + ');');
+        } else if (isFunc) {
             parts.push('DUK__ROMFUN_INIT(' + sharedFields.concat([
                 nativeFunc, nargs, magic
             ]).join(',') + ');');
         } else if (o.class === 'Array') {
-            var arrlen = 0;
+            var arrlen = numItems;
             parts.push('DUK__ROMARR_INIT(' + sharedFields.concat([
                 arrlen
             ]).join(',') + ');');
@@ -385,6 +499,19 @@ function emitObjectsSource(genc, meta, biStrMap) {
 
     emitObjectForwardDeclarations(genc, meta, objs);
     genc.emitLine('');
+
+    // Emit fixed buffers and compiled function data (constants, inner
+    // functions, bytecode) which objects and property tables reference.
+
+    if (hasCompiledFunctionsOrBuffers(meta)) {
+        genc.emitLine('#if defined(DUK_USE_HEAPPTR16) || defined(DUK_USE_BUFLEN16)');
+        genc.emitLine('#error ROM compiled functions are not supported with DUK_USE_HEAPPTR16 or DUK_USE_BUFLEN16');
+        genc.emitLine('#endif');
+        emitRomBuffers(genc, meta);
+        emitCompiledFunctionData(genc, meta, objs, biStrMap, biObjMap);
+        genc.emitLine('');
+    }
+
     emitObjectDefinitions(genc, meta, objs, biObjMap, compressRomPtr);
     genc.emitLine('');
 
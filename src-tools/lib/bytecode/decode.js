@@ -168,7 +168,7 @@ function decodeBytecode(dv, off, opts) {
     var res = {};
     var sig;
 
-    sig = dv.getUint8(dv, off);
+    sig = dv.getUint8(off);
     off++;
     if (sig === 0xff) {
         throw new TypeError('pre-Duktape 2.2 0xFF signature byte (signature byte is 0xBF since Duktape 2.2)');
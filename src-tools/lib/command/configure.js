@@ -83,6 +83,8 @@ const configureCommandSpec = createBareObject({
             opts.userBuiltinFiles.push(v);
         }, description: 'Built-in string/object YAML metadata to be applied over default built-ins (multiple files may be given, applied in sequence)' },
         'separate-sources': { type: 'boolean', default: false, value: true, deprecated: true, description: 'Output separate sources instead of amalgamated source (default is amalgamated)' },
+        'hotcold-profile': { type: 'path', default: void 0, description: 'YAML file listing hot and cold functions for DUK_HOT/DUK_COLD annotations (default is src-input/hotcold.yaml)' },
+        'omit-hotcold-profile': { type: 'boolean', default: false, value: true, description: 'Omit DUK_HOT/DUK_COLD function annotations based on the hot/cold profile' },
         'line-directives': { type: 'boolean', default: false, value: true, description: 'Output #line directives in amalgamated source (default is false)' },
         'dll': { type: 'boolean', default: false, value: true, description: 'Enable DLL build of Duktape, affects symbol visibility macros especially on Windows' },
         'c99-types-only': { type: 'boolean', default: false, value: true, description: 'Assume C99 types, no legacy type detection' },
@@ -149,6 +151,8 @@ function configureCommand(cmdline, autoDuktapeRoot) {
         userBuiltinFiles,
         romAutoLightFunc: opts['rom-auto-lightfunc'],
         lineDirectives: opts['line-directives'],
+        hotColdProfileFile: opts['hotcold-profile'],
+        omitHotColdProfile: opts['omit-hotcold-profile'],
         c99TypesOnly: opts['c99-types-only'],
         dll: opts['dll'],
         romSupport: opts['rom-support'],
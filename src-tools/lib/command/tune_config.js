@@ -0,0 +1,69 @@
+'use strict';
+
+const { configureCommandSpec } = require('./configure');
+const { tuneConfig, defaultCandidates, parseCandidateFile } = require('../configure/tune_config');
+const { pathJoin, createTempDir, dirExists, mkdir } = require('../util/fs');
+const { createBareObject } = require('../util/bare');
+const { assert } = require('../util/assert');
+
+// Base config options are given like for 'configure'.
+const sharedOptionNames = [
+    'source-directory', 'config-directory', 'option-file', 'option-yaml',
+    'define', 'undefine', 'fixup-line', 'fixup-file', 'line-directives'
+];
+
+const tuneConfigCommandSpec = createBareObject({
+    description: 'Choose config options by building and timing the duk command line tool against a workload',
+    optionsInitCallback: (opts) => {
+        configureCommandSpec.optionsInitCallback(opts);
+        opts.ccOptions = [];
+    },
+    options: Object.assign(createBareObject({}), ...sharedOptionNames.map((k) => ({ [k]: configureCommandSpec.options[k] })), createBareObject({
+        'output': { type: 'path', short: 'o', default: void 0, required: true, description: 'Output YAML file for tuned config options' },
+        'report': { type: 'path', default: void 0, description: 'Output JSON file for timing results' },
+        'work-directory': { type: 'path', default: void 0, description: 'Directory for candidate builds (default is to create a temp directory)' },
+        'candidate-file': { type: 'path', default: void 0, description: 'YAML file mapping config options to candidate value lists (default is a built-in set)' },
+        'cc': { type: 'string', default: 'gcc', description: 'C compiler command' },
+        'cc-option': { type: 'string', repeat: true, callback: (v, opts) => {
+            opts.ccOptions.push(v);
+        }, description: 'C compiler option (may be given multiple times, default is -O2 -std=c99)' },
+        'count': { type: 'string', default: '3', description: 'Number of workload runs per candidate, minimum time is used' },
+        'threshold': { type: 'string', default: '1', description: 'Minimum improvement (percent) needed to select a candidate value' },
+        'passes': { type: 'string', default: '1', description: 'Maximum number of passes over candidate options' }
+    }))
+});
+exports.tuneConfigCommandSpec = tuneConfigCommandSpec;
+
+function tuneConfigCommand(cmdline, autoDuktapeRoot) {
+    var opts = cmdline.commandOpts;
+    var workload = cmdline.commandPositional;
+
+    if (workload.length === 0) {
+        throw new TypeError('workload file(s) required, e.g. tests/perf/test-fib.js');
+    }
+    if (!autoDuktapeRoot && opts['source-directory']) {
+        autoDuktapeRoot = pathJoin(opts['source-directory'], '..');
+    }
+    assert(autoDuktapeRoot, 'cannot locate Duktape root, use --source-directory');
+    var workDirectory = opts['work-directory'] || createTempDir();
+    if (!dirExists(workDirectory)) {
+        mkdir(workDirectory);
+    }
+
+    return tuneConfig({
+        duktapeRoot: autoDuktapeRoot,
+        configDirectory: opts['config-directory'] || pathJoin(autoDuktapeRoot, 'config'),
+        configureOpts: opts,
+        workload,
+        outputFile: opts['output'],
+        reportFile: opts['report'],
+        workDirectory,
+        candidates: opts['candidate-file'] ? parseCandidateFile(opts['candidate-file']) : defaultCandidates,
+        cc: opts['cc'],
+        ccOptions: opts.ccOptions.length > 0 ? opts.ccOptions : [ '-O2', '-std=c99' ],
+        count: Math.max(1, Number(opts['count'])),
+        threshold: Number(opts['threshold']),
+        passes: Math.max(1, Number(opts['passes']))
+    });
+}
+exports.tuneConfigCommand = tuneConfigCommand;
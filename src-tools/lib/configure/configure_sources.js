@@ -3,15 +3,16 @@
 'use strict';
 
 const { readFileUtf8, writeFileUtf8, readFileJson, writeFileJsonPretty, writeFileYamlPretty, mkdir } = require('../util/fs');
-const { pathJoin, getCwd } = require('../util/fs');
+const { pathJoin, getCwd, fileExists } = require('../util/fs');
 const { getDukVersion } = require('../configure/duk_version');
 const { generateDukConfigHeader } = require('../config/gen_duk_config');
 const { generateBuiltins } = require('../builtins/gen_builtins');
 const { cStrEncode } = require('../util/cquote');
 const { GenerateC } = require('../util/generate_c');
 const { combineSources } = require('../amalgamate/combine_src');
+const { loadHotColdProfile } = require('../amalgamate/hotcold');
 const { parseUnicodeText } = require('../unicode/parser');
-const { createConversionMaps, removeConversionMapAscii, generateCaseconvTables } = require('../unicode/case_conversion');
+const { createConversionMaps, removeConversionMapAscii, generateCaseconvTables, generateCaseconvLookup } = require('../unicode/case_conversion');
 const { extractCategories } = require('../unicode/categories');
 const { filterCpMap, generateMatchTable3 } = require('../unicode/chars');
 const { codepointSequenceToRanges, rangesToPrettyRangesDump, rangesToTextBitmapDump, dumpUnicodeCategories } = require('../unicode/util');
@@ -24,6 +25,12 @@ const { getGitInfo } = require('../configure/git_info');
 const { copyFiles, copyAndCQuote, copyFileUtf8AtSignReplace } = require('../configure/util');
 const { assert } = require('../util/assert');
 
+// Codepoint range [start,end[ covered by the case conversion direct lookup
+// tables: Latin-1 Supplement, Latin Extended-A/B, IPA Extensions, Greek,
+// and Cyrillic.
+const CASECONV_LOOKUP_START = 0x80;
+const CASECONV_LOOKUP_END = 0x500;
+
 // Create a prologue for combined duktape.c.
 function createSourcePrologue(args) {
     // Because duktape.c/duktape.h/duk_config.h are often distributed or
@@ -95,6 +102,8 @@ function generateUnicodeFiles(unicodeDataFile, specialCasingFile, tempDirectory,
     removeConversionMapAscii(convLcMap);
     var { data: convUcNoa } = generateCaseconvTables(convUcMap);
     var { data: convLcNoa } = generateCaseconvTables(convLcMap);
+    var convUcLookup = generateCaseconvLookup(convMaps.uc, CASECONV_LOOKUP_START, CASECONV_LOOKUP_END);
+    var convLcLookup = generateCaseconvLookup(convMaps.lc, CASECONV_LOOKUP_START, CASECONV_LOOKUP_END);
 
     // RegExp canonicalization tables.
     var reCanonTab = generateReCanonDirectLookup(convMaps.uc);
@@ -231,7 +240,38 @@ function generateUnicodeFiles(unicodeDataFile, specialCasingFile, tempDirectory,
         writeFileUtf8(pathJoin(srcGenDirectory, 'duk_unicode_caseconv.h'), genc.getString());
     }
 
+    function emitCaseconvLookup(ucData, lcData) {
+        var genc;
+
+        genc = new GenerateC();
+        genc.emitArray(ucData, {
+            tableName: 'duk_unicode_caseconv_uc_lookup',
+            typeName: 'duk_uint16_t',
+            useConst: true,
+            useCast: false,
+            visibility: 'DUK_INTERNAL'
+        });
+        genc.emitArray(lcData, {
+            tableName: 'duk_unicode_caseconv_lc_lookup',
+            typeName: 'duk_uint16_t',
+            useConst: true,
+            useCast: false,
+            visibility: 'DUK_INTERNAL'
+        });
+        writeFileUtf8(pathJoin(srcGenDirectory, 'duk_unicode_caseconv_lookup.c'), genc.getString());
+
+        genc = new GenerateC();
+        genc.emitDefine('DUK_CASECONV_LOOKUP_START', CASECONV_LOOKUP_START);
+        genc.emitDefine('DUK_CASECONV_LOOKUP_END', CASECONV_LOOKUP_END);
+        genc.emitLine('#if !defined(DUK_SINGLE_FILE)');
+        genc.emitLine('DUK_INTERNAL_DECL const duk_uint16_t duk_unicode_caseconv_uc_lookup[' + ucData.length + '];');
+        genc.emitLine('DUK_INTERNAL_DECL const duk_uint16_t duk_unicode_caseconv_lc_lookup[' + lcData.length + '];');
+        genc.emitLine('#endif');
+        writeFileUtf8(pathJoin(srcGenDirectory, 'duk_unicode_caseconv_lookup.h'), genc.getString());
+    }
+
     emitCaseconvTables(convUcNoa, convLcNoa);
+    emitCaseconvLookup(convUcLookup, convLcLookup);
     emitMatchTable(matchWs, 'duk_unicode_ws');  // not used runtime, but dump is useful
     emitMatchTable(matchIdStartNoa, 'duk_unicode_ids_noa');
     emitMatchTable(matchIdStartNoabmp, 'duk_unicode_ids_noabmp');
@@ -391,6 +431,16 @@ function configureSources(args) {
                                               authorsFile: pathJoin(tempDirectory, 'AUTHORS.rst.tmp') });
     writeFileUtf8(pathJoin(tempDirectory, 'prologue.tmp'), prologueData);
 
+    // Hot/cold profile for function annotations, explicit file or default
+    // profile in the source directory.
+    var hotColdProfile;
+    if (!args.omitHotColdProfile) {
+        let fn = args.hotColdProfileFile || pathJoin(sourceDirectory, 'hotcold.yaml');
+        if (args.hotColdProfileFile || fileExists(fn)) {
+            hotColdProfile = loadHotColdProfile(fn);
+        }
+    }
+
     // Combine sources,including autogenerated Unicode tables.
     var tmpSourceFiles = sourceFiles.concat([ 'duk_builtins.c' ]);
     var sourceList = selectCombinedSources(tmpSourceFiles, srcTempDirectory);
@@ -400,7 +450,8 @@ function configureSources(args) {
         includeExcluded: [ 'duk_config.h', 'duktape.h' ],
         includePaths: [ srcTempDirectory, srcGenDirectory ],
         prologueFileName: pathJoin(tempDirectory, 'prologue.tmp'),
-        lineDirectives
+        lineDirectives,
+        hotColdProfile
     }));
     writeFileUtf8(pathJoin(outputDirectory, 'duktape.c'), combinedSource);
 
@@ -82,6 +82,7 @@ const sourceFiles = [
     'duk_heap_markandsweep.c',
     'duk_heap_memory.c',
     'duk_heap_misc.c',
+    'duk_heap_protocache.c',
     'duk_heap_refcount.c',
     'duk_heap_stringcache.c',
     'duk_heap_stringtable.c',
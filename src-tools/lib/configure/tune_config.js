@@ -0,0 +1,231 @@
+/*
+ *  Workload driven config option tuning.
+ *
+ *  Configures and builds the 'duk' command line tool for a series of
+ *  candidate option sets, times a user supplied workload with each build,
+ *  and greedily keeps the fastest value for each candidate option in turn
+ *  (coordinate descent).  Candidates whose build or workload run fails, or
+ *  whose workload output differs from the baseline build, are rejected.
+ *
+ *  The result is an options YAML file which can be given to 'configure'
+ *  using --option-file, on top of the option files used for tuning.
+ */
+
+'use strict';
+
+const { configureCommand } = require('../command/configure');
+const { pathJoin, mkdir, fileExists, readFileYaml, writeFileUtf8, writeFileJsonPretty } = require('../util/fs');
+const { exec } = require('../util/exec');
+const { utf8Uint8ArrayToString } = require('../extbindings/utf8');
+const { createBareObject } = require('../util/bare');
+const { assert } = require('../util/assert');
+
+// Default candidate options and values.  Values are tried in order; the
+// current (forced or default) value of an option is the baseline and is
+// not rebuilt.
+const defaultCandidates = [
+    { option: 'DUK_USE_FASTINT', values: [ true, false ] },
+    { option: 'DUK_USE_PACKED_TVAL', values: [ false, true ] },
+    { option: 'DUK_USE_EXEC_PREFER_SIZE', values: [ false, true ] },
+    { option: 'DUK_USE_EXEC_FUN_LOCAL', values: [ false, true ] },
+    { option: 'DUK_USE_HOBJECT_HASH_PROP_LIMIT', values: [ 4, 8, 16, 32 ] },
+    { option: 'DUK_USE_STRTAB_MINSIZE', values: [ 1024, 4096, 16384 ] },
+    { option: 'DUK_USE_LITCACHE_SIZE', values: [ 256, 1024 ] },
+    { option: 'DUK_USE_INTCACHE_SIZE', values: [ 256, 1024 ] },
+    { option: 'DUK_USE_PROTOCACHE_SIZE', values: [ 256, 1024 ] },
+    { option: 'DUK_USE_VALSTACK_UNSAFE', values: [ false, true ] },
+    { option: 'DUK_USE_FAST_REFCOUNT_DEFAULT', values: [ false, true ] }
+];
+exports.defaultCandidates = defaultCandidates;
+
+// Candidate file format is a YAML mapping from option name to a list of
+// values, e.g. "DUK_USE_LITCACHE_SIZE: [ 256, 1024, 4096 ]".
+function parseCandidateFile(fn) {
+    var doc = readFileYaml(fn);
+    return Object.keys(doc).map((k) => {
+        let v = doc[k];
+        if (!Array.isArray(v) || v.length === 0) {
+            throw new TypeError('invalid candidate values for ' + k + ', expected a non-empty list');
+        }
+        return { option: k, values: v };
+    });
+}
+exports.parseCandidateFile = parseCandidateFile;
+
+// Option values may come from YAML (booleans, numbers) or -D (strings).
+function sameOptionValue(a, b) {
+    return String(a) === String(b);
+}
+
+function formatSeconds(t) {
+    return (t === null ? 'n/a' : t.toFixed(3) + ' s');
+}
+
+function cmdlineBuildCommand(args, prepDir, exeFile) {
+    var root = args.duktapeRoot;
+    return [ args.cc, '-o', exeFile, '-I' + prepDir,
+             '-I' + pathJoin(root, 'examples', 'cmdline'),
+             '-I' + pathJoin(root, 'extras', 'print-alert'),
+             '-I' + pathJoin(root, 'extras', 'console'),
+             '-DDUK_CMDLINE_PRINTALERT_SUPPORT',
+             '-DDUK_CMDLINE_CONSOLE_SUPPORT' ]
+        .concat(args.ccOptions)
+        .concat([ pathJoin(prepDir, 'duktape.c'),
+                  pathJoin(root, 'examples', 'cmdline', 'duk_cmdline.c'),
+                  pathJoin(root, 'extras', 'print-alert', 'duk_print_alert.c'),
+                  pathJoin(root, 'extras', 'console', 'duk_console.c'),
+                  '-lm' ]);
+}
+
+function execFailed(res) {
+    return !!(res.error || (typeof res.status === 'number' && res.status !== 0) || res.signal);
+}
+
+// Configure, build, and time one option set.  Returns an object with the
+// minimum workload time and the workload output, or a .failure string.
+function evaluateOptions(args, forcedOptions, state) {
+    var candDir = pathJoin(args.workDirectory, 'cand-' + (state.candidateCount++));
+    var prepDir = pathJoin(candDir, 'prep');
+    var tempDir = pathJoin(candDir, 'tmp');
+    var exeFile = pathJoin(candDir, 'duk');
+    mkdir(candDir);
+    mkdir(tempDir);
+
+    try {
+        configureCommand({
+            commandOpts: Object.assign(createBareObject({}), args.configureOpts, {
+                'output-directory': prepDir,
+                'temp-directory': tempDir,
+                forcedOptions: forcedOptions
+            })
+        }, args.duktapeRoot);
+    } catch (e) {
+        return { failure: 'configure failed: ' + e };
+    }
+
+    var res = exec(cmdlineBuildCommand(args, prepDir, exeFile));
+    if (execFailed(res)) {
+        return { failure: 'build failed: ' + (res.stderr ? utf8Uint8ArrayToString(res.stderr).split('\n')[0] : String(res.error)) };
+    }
+
+    var timeMin = null;
+    var output;
+    for (let i = 0; i < args.count; i++) {
+        let start = Date.now();
+        res = exec([ exeFile ].concat(args.workload));
+        let time = (Date.now() - start) / 1000;
+        if (execFailed(res)) {
+            return { failure: 'workload failed' };
+        }
+        output = utf8Uint8ArrayToString(res.stdout);
+        timeMin = (timeMin === null ? time : Math.min(timeMin, time));
+    }
+
+    return { time: timeMin, output: output };
+}
+
+// Tune candidate options for a workload.  Returns a report object and
+// writes the tuned option YAML to args.outputFile.
+function tuneConfig(args) {
+    var forcedOptions = Object.assign(createBareObject({}), assert(args.configureOpts.forcedOptions));
+    var state = { candidateCount: 0 };
+    var report = { workload: args.workload, baseline: null, tuned: null, passes: [] };
+
+    function currentValue(option) {
+        if (option in forcedOptions) {
+            return forcedOptions[option];
+        }
+        var fn = pathJoin(args.configDirectory, 'config-options', option + '.yaml');
+        if (!fileExists(fn)) {
+            throw new TypeError('unknown config option: ' + option);
+        }
+        return readFileYaml(fn).default;
+    }
+
+    console.log('tune-config: evaluating baseline');
+    var best = evaluateOptions(args, forcedOptions, state);
+    if (best.failure) {
+        throw new TypeError('baseline ' + best.failure);
+    }
+    var baselineOutput = best.output;
+    report.baseline = best.time;
+    console.log('tune-config: baseline time ' + formatSeconds(best.time));
+
+    var chosen = createBareObject({});
+    for (let pass = 0; pass < args.passes; pass++) {
+        let passResults = [];
+        let changed = false;
+
+        for (let cand of args.candidates) {
+            let current = currentValue(cand.option);
+            let results = [ { value: current, time: best.time } ];
+
+            for (let value of cand.values) {
+                if (sameOptionValue(value, current)) {
+                    continue;
+                }
+                let trial = Object.assign(createBareObject({}), forcedOptions);
+                trial[cand.option] = value;
+                console.log('tune-config: trying ' + cand.option + '=' + value);
+                let res = evaluateOptions(args, trial, state);
+                if (!res.failure && res.output !== baselineOutput) {
+                    res = { failure: 'workload output differs from baseline' };
+                }
+                if (res.failure) {
+                    console.log('tune-config: ' + cand.option + '=' + value + ' rejected, ' + res.failure);
+                    results.push({ value: value, time: null, failure: res.failure });
+                    continue;
+                }
+                console.log('tune-config: ' + cand.option + '=' + value + ' time ' + formatSeconds(res.time));
+                results.push({ value: value, time: res.time });
+            }
+
+            // Keep the fastest value only if it beats the current one by
+            // more than the threshold, to avoid chasing timing noise.
+            let winner = results[0];
+            for (let r of results.slice(1)) {
+                if (r.time !== null && r.time < winner.time) {
+                    winner = r;
+                }
+            }
+            if (winner !== results[0] && winner.time < results[0].time * (1 - args.threshold / 100)) {
+                console.log('tune-config: selected ' + cand.option + '=' + winner.value);
+                forcedOptions[cand.option] = winner.value;
+                best = { time: winner.time };
+                changed = true;
+            }
+            chosen[cand.option] = { value: currentValue(cand.option), results: results };
+            passResults.push({ option: cand.option, results: results });
+        }
+
+        report.passes.push(passResults);
+        if (!changed) {
+            break;
+        }
+    }
+    report.tuned = best.time;
+    report.options = createBareObject({});
+    for (let k of Object.keys(chosen)) {
+        report.options[k] = chosen[k].value;
+    }
+    console.log('tune-config: tuned time ' + formatSeconds(best.time) + ', options ' + JSON.stringify(report.options));
+
+    var lines = [];
+    lines.push('# Config options tuned for workload using "duktool tune-config".');
+    lines.push('# Apply on top of the option files used for tuning.');
+    lines.push('#');
+    lines.push('# Workload: ' + args.workload.join(' '));
+    lines.push('# Baseline time: ' + formatSeconds(report.baseline) + ', tuned time: ' + formatSeconds(report.tuned));
+    lines.push('');
+    for (let k of Object.keys(chosen)) {
+        let times = chosen[k].results.map((r) => r.value + ': ' + (r.failure ? 'failed' : formatSeconds(r.time))).join(', ');
+        lines.push(k + ': ' + JSON.stringify(chosen[k].value) + '  # ' + times);
+    }
+    writeFileUtf8(args.outputFile, lines.join('\n') + '\n');
+    if (args.reportFile) {
+        writeFileJsonPretty(args.reportFile, report);
+    }
+
+    return report;
+}
+exports.tuneConfig = tuneConfig;
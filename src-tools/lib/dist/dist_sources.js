@@ -59,6 +59,7 @@ function getSourceFiles() {
         'duktape.h.in',  // excluded from sourceFiles
         'builtins.yaml',
         'strings.yaml',
+        'hotcold.yaml',
         'SpecialCasing.txt',
         'SpecialCasing-8bit.txt',
         'UnicodeData.txt',
@@ -13,6 +13,7 @@ const { distCommand, distCommandSpec } = require('../command/dist');
 const { decodeBytecodeCommand, decodeBytecodeCommandSpec } = require('../command/decode_bytecode');
 const { dumpBytecodeCommand, dumpBytecodeCommandSpec } = require('../command/dump_bytecode');
 const { generateReleasesRstCommand, generateReleasesRstCommandSpec } = require('../command/generate_releases_rst');
+const { tuneConfigCommand, tuneConfigCommandSpec } = require('../command/tune_config');
 
 // Command line parsing spec.
 
@@ -24,7 +25,8 @@ const commandSpec = {
         ['dist']: distCommandSpec,
         ['decode-bytecode']: decodeBytecodeCommandSpec,
         ['dump-bytecode']: dumpBytecodeCommandSpec,
-        ['generate-releases-rst']: generateReleasesRstCommandSpec
+        ['generate-releases-rst']: generateReleasesRstCommandSpec,
+        ['tune-config']: tuneConfigCommandSpec
     })
 };
 
@@ -88,6 +90,9 @@ function main() {
         },
         ['generate-releases-rst']: () => {
             generateReleasesRstCommand(cmdline, autoDuktapeRoot);
+        },
+        ['tune-config']: () => {
+            tuneConfigCommand(cmdline, autoDuktapeRoot);
         }
     });
 
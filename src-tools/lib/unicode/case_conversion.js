@@ -274,6 +274,27 @@ function removeArrayNulls(arr) {
     return arr;
 }
 
+// Generate a direct lookup table for codepoints [start,end[ for the C
+// lookup fast path.  Each entry is the 1:1 conversion result, or the
+// codepoint itself if there's no rule.  Conversions to multiple codepoints
+// are marked with 0 and handled by the bitstream.
+function generateCaseconvLookup(convmap, start, end) {
+    var res = [];
+    for (let cp = start; cp < end; cp++) {
+        let v = convmap[cp];
+        if (!v) {
+            res.push(cp);
+        } else if (v.length === 1) {
+            assert(v[0] !== 0 && v[0] < 0x10000);
+            res.push(v[0]);
+        } else {
+            res.push(0);
+        }
+    }
+    return res;
+}
+exports.generateCaseconvLookup = generateCaseconvLookup;
+
 function generateCaseconvTables(convmap) {
     console.debug('generate caseconv tables');
     var t = scanCaseconvTables(removeArrayNulls(jsonDeepClone(convmap)));
@@ -31,6 +31,7 @@ static duk_ret_t test_func(duk_context *ctx, void *udata) {
 	(void) duk_alloc_raw(ctx, 0);
 	(void) duk_alloc(ctx, 0);
 	(void) duk_base64_decode(ctx, 0);
+	(void) duk_base64_decode_into(ctx, 0, NULL, 0);
 	(void) duk_base64_encode(ctx, 0);
 	(void) duk_buffer_to_string(ctx, 0);
 	(void) duk_call_method(ctx, 0);
@@ -63,6 +64,7 @@ static duk_ret_t test_func(duk_context *ctx, void *udata) {
 	(void) duk_decode_string(ctx, 0, NULL, NULL);
 	(void) duk_def_prop(ctx, 0, 0);
 	(void) duk_del_prop_heapptr(ctx, 0, NULL);
+	(void) duk_del_prop_key(ctx, 0, NULL);
 	(void) duk_del_prop_index(ctx, 0, 0);
 	(void) duk_del_prop_literal(ctx, 0, "dummy");
 	(void) duk_del_prop_lstring(ctx, 0, "dummy", 0);
@@ -91,6 +93,8 @@ static duk_ret_t test_func(duk_context *ctx, void *udata) {
 	(void) duk_gc(ctx, 0);
 	duk_generic_error(ctx, "dummy");
 	duk_generic_error_va(ctx, "dummy", dummy_ap);
+	(void) duk_get_array_doubles(ctx, 0, 0, NULL, 0);
+	(void) duk_get_array_int32s(ctx, 0, 0, NULL, 0);
 	(void) duk_get_boolean(ctx, 0);
 	(void) duk_get_boolean_default(ctx, 0, 0);
 	(void) duk_get_buffer_data(ctx, 0, NULL);
@@ -103,6 +107,7 @@ static duk_ret_t test_func(duk_context *ctx, void *udata) {
 	(void) duk_get_context_default(ctx, 0, NULL);
 	(void) duk_get_current_magic(ctx);
 	(void) duk_get_error_code(ctx, 0);
+	(void) duk_get_field_list(ctx, 0, NULL, NULL);
 	(void) duk_get_finalizer(ctx, 0);
 	(void) duk_get_global_heapptr(ctx, NULL);
 	(void) duk_get_global_literal(ctx, "dummy");
@@ -124,6 +129,7 @@ static duk_ret_t test_func(duk_context *ctx, void *udata) {
 	(void) duk_get_pointer_default(ctx, 0, NULL);
 	(void) duk_get_prop_desc(ctx, 0, 0);
 	(void) duk_get_prop_heapptr(ctx, 0, NULL);
+	(void) duk_get_prop_key(ctx, 0, NULL);
 	(void) duk_get_prop_index(ctx, 0, 0);
 	(void) duk_get_prop_literal(ctx, 0, "dummy");
 	(void) duk_get_prop_lstring(ctx, 0, "dummy", 0);
@@ -139,12 +145,14 @@ static duk_ret_t test_func(duk_context *ctx, void *udata) {
 	(void) duk_get_uint(ctx, 0);
 	(void) duk_get_uint_default(ctx, 0, 0);
 	(void) duk_has_prop_heapptr(ctx, 0, NULL);
+	(void) duk_has_prop_key(ctx, 0, NULL);
 	(void) duk_has_prop_index(ctx, 0, 0);
 	(void) duk_has_prop_literal(ctx, 0, "dummy");
 	(void) duk_has_prop_lstring(ctx, 0, "dummy", 0);
 	(void) duk_has_prop_string(ctx, 0, "dummy");
 	(void) duk_has_prop(ctx, 0);
 	(void) duk_hex_decode(ctx, 0);
+	(void) duk_hex_decode_into(ctx, 0, NULL, 0);
 	(void) duk_hex_encode(ctx, 0);
 	(void) duk_insert(ctx, 0);
 	(void) duk_inspect_value(ctx, 0);
@@ -220,6 +228,7 @@ static duk_ret_t test_func(duk_context *ctx, void *udata) {
 	(void) duk_peval_string_noresult(ctx, "dummy");
 	(void) duk_peval_string(ctx, "dummy");
 	(void) duk_peval(ctx);
+	(void) duk_pin_key(ctx, 0);
 	(void) duk_pnew(ctx, 0);
 	(void) duk_pop_2(ctx);
 	(void) duk_pop_3(ctx);
@@ -227,6 +236,8 @@ static duk_ret_t test_func(duk_context *ctx, void *udata) {
 	(void) duk_pop(ctx);
 	(void) duk_pull(ctx, 0);
 	(void) duk_push_array(ctx);
+	(void) duk_push_array_doubles(ctx, NULL, 0);
+	(void) duk_push_array_int32s(ctx, NULL, 0);
 	(void) duk_push_bare_object(ctx);
 	(void) duk_push_boolean(ctx, 0);
 	(void) duk_push_buffer_object(ctx, 0, 0, 0, 0);
@@ -266,6 +277,7 @@ static duk_ret_t test_func(duk_context *ctx, void *udata) {
 	(void) duk_push_uint(ctx, 0);
 	(void) duk_push_undefined(ctx);
 	(void) duk_push_vsprintf(ctx, "dummy", dummy_ap);
+	(void) duk_put_field_list(ctx, 0, NULL, NULL);
 	(void) duk_put_function_list(ctx, 0, NULL);
 	(void) duk_put_global_heapptr(ctx, NULL);
 	(void) duk_put_global_literal(ctx, "dummy");
@@ -273,6 +285,7 @@ static duk_ret_t test_func(duk_context *ctx, void *udata) {
 	(void) duk_put_global_string(ctx, "dummy");
 	(void) duk_put_number_list(ctx, 0, NULL);
 	(void) duk_put_prop_heapptr(ctx, 0, NULL);
+	(void) duk_put_prop_key(ctx, 0, NULL);
 	(void) duk_put_prop_index(ctx, 0, 0);
 	(void) duk_put_prop_literal(ctx, 0, "dummy");
 	(void) duk_put_prop_lstring(ctx, 0, "dummy", 0);
@@ -358,6 +371,7 @@ static duk_ret_t test_func(duk_context *ctx, void *udata) {
 	(void) duk_trim(ctx, 0);
 	duk_type_error(ctx, "dummy");
 	duk_type_error_va(ctx, "dummy", dummy_ap);
+	duk_unpin_key(ctx, NULL);
 	duk_uri_error(ctx, "dummy");
 	duk_uri_error_va(ctx, "dummy", dummy_ap);
 	(void) duk_xcopy_top(ctx, NULL, 0);
@@ -30,6 +30,9 @@
  *  a tailcall even in an ECMAScript-to-ECMAScript case if the current
  *  frame was called from C.
  *
+ *  Current behavior is to allow the tailcall and to keep
+ *  DUK_ACT_FLAG_PREVENT_YIELD set in the reused activation.
+ *
  *  NOTE: test_1() only fails with asserts enabled.
  */
 
@@ -0,0 +1,172 @@
+/*
+ *  duk_base64_decode_into(), duk_hex_decode_into()
+ */
+
+/*===
+*** test_base64 (duk_safe_call)
+base64 decoded 11: test string
+base64 decoded 3: foo
+base64 decoded 6: foobar
+base64 decoded 0: 
+value: dGVzdCBzdHJpbmc= string
+final top: 1
+==> rc=0, result='undefined'
+*** test_base64_buffer_input (duk_safe_call)
+base64 decoded 3: foo
+final top: 1
+==> rc=0, result='undefined'
+*** test_base64_too_small (duk_safe_call)
+==> rc=1, result='RangeError: result too long'
+*** test_base64_invalid (duk_safe_call)
+==> rc=1, result='TypeError: base64 decode failed'
+*** test_hex (duk_safe_call)
+hex decoded 11: test string
+hex decoded 0: 
+coerced: 1234 string
+hex decoded 2: 1234
+final top: 1
+==> rc=0, result='undefined'
+*** test_hex_too_small (duk_safe_call)
+==> rc=1, result='RangeError: result too long'
+*** test_hex_invalid (duk_safe_call)
+==> rc=1, result='TypeError: hex decode failed'
+===*/
+
+static void print_result(const char *name, const char *buf, duk_size_t n) {
+	printf("%s decoded %lu: %.*s\n", name, (unsigned long) n, (int) n, buf);
+}
+
+static duk_ret_t test_base64(duk_context *ctx, void *udata) {
+	char buf[64];
+	char small[3];
+	duk_size_t n;
+
+	(void) udata;
+
+	/* Large enough buffer: decoded directly. */
+	duk_push_string(ctx, "dGVzdCBzdHJpbmc=");
+	n = duk_base64_decode_into(ctx, -1, (void *) buf, sizeof(buf));
+	print_result("base64", buf, n);
+	duk_pop(ctx);
+
+	/* Exact size buffer: decoded via a temporary. */
+	duk_push_string(ctx, "Zm9v");
+	n = duk_base64_decode_into(ctx, -1, (void *) small, sizeof(small));
+	print_result("base64", small, n);
+	duk_pop(ctx);
+
+	/* Whitespace and padding are handled like in duk_base64_decode(). */
+	duk_push_string(ctx, "Zm9v\nYmFy\n");
+	n = duk_base64_decode_into(ctx, -1, (void *) buf, sizeof(buf));
+	print_result("base64", buf, n);
+	duk_pop(ctx);
+
+	duk_push_string(ctx, "");
+	n = duk_base64_decode_into(ctx, -1, NULL, 0);
+	print_result("base64", buf, n);
+	duk_pop(ctx);
+
+	/* Input value is left in place. */
+	duk_push_string(ctx, "dGVzdCBzdHJpbmc=");
+	(void) duk_base64_decode_into(ctx, -1, (void *) buf, sizeof(buf));
+	printf("value: %s %s\n", duk_get_string(ctx, -1), duk_is_string(ctx, -1) ? "string" : "other");
+
+	printf("final top: %ld\n", (long) duk_get_top(ctx));
+	return 0;
+}
+
+static duk_ret_t test_base64_buffer_input(duk_context *ctx, void *udata) {
+	char buf[16];
+	duk_size_t n;
+	void *p;
+
+	(void) udata;
+
+	p = duk_push_fixed_buffer(ctx, 4);
+	memcpy(p, (const void *) "Zm9v", 4);
+	n = duk_base64_decode_into(ctx, -1, (void *) buf, sizeof(buf));
+	print_result("base64", buf, n);
+
+	printf("final top: %ld\n", (long) duk_get_top(ctx));
+	return 0;
+}
+
+static duk_ret_t test_base64_too_small(duk_context *ctx, void *udata) {
+	char buf[2];
+
+	(void) udata;
+
+	duk_push_string(ctx, "Zm9v");
+	(void) duk_base64_decode_into(ctx, -1, (void *) buf, sizeof(buf));
+	printf("never here\n");
+	return 0;
+}
+
+static duk_ret_t test_base64_invalid(duk_context *ctx, void *udata) {
+	char buf[64];
+
+	(void) udata;
+
+	duk_push_string(ctx, "Zm9v!");
+	(void) duk_base64_decode_into(ctx, -1, (void *) buf, sizeof(buf));
+	printf("never here\n");
+	return 0;
+}
+
+static duk_ret_t test_hex(duk_context *ctx, void *udata) {
+	char buf[64];
+	duk_size_t n;
+
+	(void) udata;
+
+	duk_push_string(ctx, "7465737420737472696e67");
+	n = duk_hex_decode_into(ctx, -1, (void *) buf, 11);
+	print_result("hex", buf, n);
+	duk_pop(ctx);
+
+	duk_push_string(ctx, "");
+	n = duk_hex_decode_into(ctx, -1, NULL, 0);
+	print_result("hex", buf, n);
+	duk_pop(ctx);
+
+	/* Non-buffer values are coerced to string in place. */
+	duk_push_int(ctx, 1234);
+	n = duk_hex_decode_into(ctx, -1, (void *) buf, sizeof(buf));
+	printf("coerced: %s %s\n", duk_get_string(ctx, -1), duk_is_string(ctx, -1) ? "string" : "other");
+	printf("hex decoded %lu: %02x%02x\n", (unsigned long) n, (unsigned int) (unsigned char) buf[0], (unsigned int) (unsigned char) buf[1]);
+
+	printf("final top: %ld\n", (long) duk_get_top(ctx));
+	return 0;
+}
+
+static duk_ret_t test_hex_too_small(duk_context *ctx, void *udata) {
+	char buf[10];
+
+	(void) udata;
+
+	duk_push_string(ctx, "7465737420737472696e67");
+	(void) duk_hex_decode_into(ctx, -1, (void *) buf, sizeof(buf));
+	printf("never here\n");
+	return 0;
+}
+
+static duk_ret_t test_hex_invalid(duk_context *ctx, void *udata) {
+	char buf[64];
+
+	(void) udata;
+
+	duk_push_string(ctx, "7465737420737g72696e67");
+	(void) duk_hex_decode_into(ctx, -1, (void *) buf, sizeof(buf));
+	printf("never here\n");
+	return 0;
+}
+
+void test(duk_context *ctx) {
+	TEST_SAFE_CALL(test_base64);
+	TEST_SAFE_CALL(test_base64_buffer_input);
+	TEST_SAFE_CALL(test_base64_too_small);
+	TEST_SAFE_CALL(test_base64_invalid);
+	TEST_SAFE_CALL(test_hex);
+	TEST_SAFE_CALL(test_hex_too_small);
+	TEST_SAFE_CALL(test_hex_invalid);
+}
@@ -0,0 +1,202 @@
+/*
+ *  duk_pin_key(), duk_unpin_key(), and the duk_xxx_prop_key() variants
+ */
+
+/*===
+*** test_basic (duk_safe_call)
+key: foo
+put: 1
+has: 1
+get: 1 123
+del: 1
+has: 0
+get: 0 undefined
+coerced: 123 string
+get: 1 bar
+symbol: 1 quux
+final top: 1
+==> rc=0, result='undefined'
+*** test_gc (duk_safe_call)
+get: 1 42
+get: 1 43
+final top: 1
+==> rc=0, result='undefined'
+*** test_accessor (duk_safe_call)
+setter called: 321
+getter called
+get: 1 getter-value
+final top: 1
+==> rc=0, result='undefined'
+*** test_primitive_base (duk_safe_call)
+get: 1 3
+final top: 0
+==> rc=0, result='undefined'
+*** test_null_key (duk_safe_call)
+==> rc=1, result='TypeError: invalid args'
+===*/
+
+static duk_ret_t test_basic(duk_context *ctx, void *udata) {
+	void *key_foo;
+	void *key_num;
+	void *key_sym;
+	duk_bool_t rc;
+
+	(void) udata;
+
+	duk_push_object(ctx);  /* target */
+
+	duk_push_string(ctx, "foo");
+	key_foo = duk_pin_key(ctx, -1);
+	printf("key: %s\n", duk_get_string(ctx, -1));
+	duk_pop(ctx);
+
+	duk_push_int(ctx, 123);
+	rc = duk_put_prop_key(ctx, 0, key_foo);
+	printf("put: %d\n", (int) rc);
+	printf("has: %d\n", (int) duk_has_prop_key(ctx, 0, key_foo));
+	rc = duk_get_prop_key(ctx, 0, key_foo);
+	printf("get: %d %s\n", (int) rc, duk_safe_to_string(ctx, -1));
+	duk_pop(ctx);
+	printf("del: %d\n", (int) duk_del_prop_key(ctx, 0, key_foo));
+	printf("has: %d\n", (int) duk_has_prop_key(ctx, 0, key_foo));
+	rc = duk_get_prop_key(ctx, 0, key_foo);
+	printf("get: %d %s\n", (int) rc, duk_safe_to_string(ctx, -1));
+	duk_pop(ctx);
+
+	/* Non-string keys are coerced in place with ToPropertyKey(). */
+	duk_push_int(ctx, 123);
+	key_num = duk_pin_key(ctx, -1);
+	printf("coerced: %s %s\n", duk_get_string(ctx, -1), duk_is_string(ctx, -1) ? "string" : "other");
+	duk_pop(ctx);
+	duk_push_string(ctx, "bar");
+	duk_put_prop_index(ctx, 0, 123);
+	rc = duk_get_prop_key(ctx, 0, key_num);
+	printf("get: %d %s\n", (int) rc, duk_safe_to_string(ctx, -1));
+	duk_pop(ctx);
+
+	/* Symbols work as keys too. */
+	duk_eval_string(ctx, "Symbol('mySymbol')");
+	key_sym = duk_pin_key(ctx, -1);
+	duk_pop(ctx);
+	duk_push_string(ctx, "quux");
+	(void) duk_put_prop_key(ctx, 0, key_sym);
+	rc = duk_get_prop_key(ctx, 0, key_sym);
+	printf("symbol: %d %s\n", (int) rc, duk_safe_to_string(ctx, -1));
+	duk_pop(ctx);
+
+	duk_unpin_key(ctx, key_foo);
+	duk_unpin_key(ctx, key_num);
+	duk_unpin_key(ctx, key_sym);
+
+	printf("final top: %ld\n", (long) duk_get_top(ctx));
+	return 0;
+}
+
+/* A pinned key survives garbage collection even when no other reference
+ * exists.  Pins are counted.
+ */
+static duk_ret_t test_gc(duk_context *ctx, void *udata) {
+	void *key;
+	void *key2;
+
+	(void) udata;
+
+	duk_push_object(ctx);
+
+	duk_push_sprintf(ctx, "dynamic-%d", 123);
+	key = duk_pin_key(ctx, -1);
+	key2 = duk_pin_key(ctx, -1);
+	duk_pop(ctx);
+	duk_gc(ctx, 0);
+	duk_gc(ctx, 0);
+
+	duk_push_int(ctx, 42);
+	(void) duk_put_prop_key(ctx, 0, key);
+	(void) duk_get_prop_string(ctx, 0, "dynamic-123");
+	printf("get: %d %s\n", (int) duk_has_prop_key(ctx, 0, key), duk_safe_to_string(ctx, -1));
+	duk_pop(ctx);
+
+	/* Still pinned once. */
+	duk_unpin_key(ctx, key);
+	duk_del_prop_string(ctx, 0, "dynamic-123");
+	duk_gc(ctx, 0);
+	duk_gc(ctx, 0);
+
+	duk_push_int(ctx, 43);
+	(void) duk_put_prop_key(ctx, 0, key2);
+	(void) duk_get_prop_string(ctx, 0, "dynamic-123");
+	printf("get: %d %s\n", (int) duk_has_prop_key(ctx, 0, key2), duk_safe_to_string(ctx, -1));
+	duk_pop(ctx);
+
+	duk_unpin_key(ctx, key2);
+
+	printf("final top: %ld\n", (long) duk_get_top(ctx));
+	return 0;
+}
+
+/* Accessors and inheritance behave like with duk_get_prop(). */
+static duk_ret_t test_accessor(duk_context *ctx, void *udata) {
+	void *key;
+	duk_bool_t rc;
+
+	(void) udata;
+
+	duk_eval_string(ctx,
+	    "Object.create({ set foo(v) { print('setter called: ' + v); },\n"
+	    "                get foo() { print('getter called'); return 'getter-value'; } })");
+
+	duk_push_string(ctx, "foo");
+	key = duk_pin_key(ctx, -1);
+	duk_pop(ctx);
+
+	duk_push_int(ctx, 321);
+	(void) duk_put_prop_key(ctx, -2, key);
+	rc = duk_get_prop_key(ctx, -1, key);
+	printf("get: %d %s\n", (int) rc, duk_safe_to_string(ctx, -1));
+	duk_pop(ctx);
+
+	duk_unpin_key(ctx, key);
+
+	printf("final top: %ld\n", (long) duk_get_top(ctx));
+	return 0;
+}
+
+static duk_ret_t test_primitive_base(duk_context *ctx, void *udata) {
+	void *key;
+	duk_bool_t rc;
+
+	(void) udata;
+
+	duk_push_string(ctx, "length");
+	key = duk_pin_key(ctx, -1);
+	duk_pop(ctx);
+
+	duk_push_string(ctx, "abc");
+	rc = duk_get_prop_key(ctx, -1, key);
+	printf("get: %d %s\n", (int) rc, duk_safe_to_string(ctx, -1));
+	duk_pop_2(ctx);
+
+	duk_unpin_key(ctx, key);
+
+	printf("final top: %ld\n", (long) duk_get_top(ctx));
+	return 0;
+}
+
+static duk_ret_t test_null_key(duk_context *ctx, void *udata) {
+	(void) udata;
+
+	duk_unpin_key(ctx, NULL);  /* no-op */
+
+	duk_push_object(ctx);
+	(void) duk_get_prop_key(ctx, -1, NULL);
+	printf("never here\n");
+	return 0;
+}
+
+void test(duk_context *ctx) {
+	TEST_SAFE_CALL(test_basic);
+	TEST_SAFE_CALL(test_gc);
+	TEST_SAFE_CALL(test_accessor);
+	TEST_SAFE_CALL(test_primitive_base);
+	TEST_SAFE_CALL(test_null_key);
+}
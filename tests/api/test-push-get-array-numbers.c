@@ -0,0 +1,175 @@
+/*
+ *  duk_push_array_doubles(), duk_push_array_int32s(),
+ *  duk_get_array_doubles(), duk_get_array_int32s()
+ */
+
+/*===
+*** test_push (duk_safe_call)
+[1.5,-2,1e+100,null]
+true
+[0,-1,2147483647,-2147483648]
+[]
+final top: 0
+==> rc=0, result='undefined'
+*** test_get_dense (duk_safe_call)
+n=5: 1 2.5 -3 4 5
+n=2: 4 5
+n=0
+n=3: 1 2 -3
+final top: 1
+==> rc=0, result='undefined'
+*** test_get_coerce (duk_safe_call)
+valueOf called
+n=6: 1 7 nan 2 0 nan
+n=3: -1 0 1
+final top: 0
+==> rc=0, result='undefined'
+*** test_get_arraylike (duk_safe_call)
+n=3: 10 20 30
+n=2: 0.5 -1
+final top: 0
+==> rc=0, result='undefined'
+*** test_get_nonobject (duk_safe_call)
+==> rc=1, result='TypeError: object required, found 123 (stack index 0)'
+===*/
+
+static void print_doubles(duk_size_t n, const duk_double_t *vals) {
+	duk_size_t i;
+
+	printf("n=%lu", (unsigned long) n);
+	for (i = 0; i < n; i++) {
+		if (vals[i] != vals[i]) {  /* NaN */
+			printf(i == 0 ? ": nan" : " nan");
+		} else {
+			printf(i == 0 ? ": %g" : " %g", (double) vals[i]);
+		}
+	}
+	printf("\n");
+}
+
+static duk_ret_t test_push(duk_context *ctx, void *udata) {
+	duk_double_t dvals[4] = { 1.5, -2.0, 1e100, 0.0 };
+	duk_int32_t ivals[4] = { 0, -1, 2147483647L, -2147483647L - 1L };
+	duk_idx_t idx;
+
+	(void) udata;
+
+	duk_push_nan(ctx);
+	dvals[3] = duk_get_number(ctx, -1);
+	duk_pop(ctx);
+	idx = duk_push_array_doubles(ctx, dvals, 4);
+	printf("%s\n", duk_json_encode(ctx, idx));
+	duk_pop(ctx);
+
+	/* Result is an ordinary Array. */
+	duk_push_array_doubles(ctx, dvals, 4);
+	printf("%s\n", duk_is_array(ctx, -1) ? "true" : "false");
+	duk_pop(ctx);
+
+	duk_push_array_int32s(ctx, ivals, 4);
+	printf("%s\n", duk_json_encode(ctx, -1));
+	duk_pop(ctx);
+
+	duk_push_array_int32s(ctx, NULL, 0);
+	printf("%s\n", duk_json_encode(ctx, -1));
+	duk_pop(ctx);
+
+	printf("final top: %ld\n", (long) duk_get_top(ctx));
+	return 0;
+}
+
+static duk_ret_t test_get_dense(duk_context *ctx, void *udata) {
+	duk_double_t dvals[8];
+	duk_int32_t ivals[8];
+	duk_size_t n;
+
+	(void) udata;
+
+	duk_eval_string(ctx, "[ 1, 2.5, -3, 4, 5 ]");
+
+	/* Count is clamped to array length. */
+	n = duk_get_array_doubles(ctx, -1, 0, dvals, 8);
+	print_doubles(n, dvals);
+
+	n = duk_get_array_doubles(ctx, -1, 3, dvals, 8);
+	print_doubles(n, dvals);
+
+	n = duk_get_array_doubles(ctx, -1, 10, dvals, 8);
+	print_doubles(n, dvals);
+
+	n = duk_get_array_int32s(ctx, -1, 0, ivals, 3);
+	printf("n=%lu: %ld %ld %ld\n", (unsigned long) n, (long) ivals[0], (long) ivals[1], (long) ivals[2]);
+
+	printf("final top: %ld\n", (long) duk_get_top(ctx));
+	return 0;
+}
+
+static duk_ret_t test_get_coerce(duk_context *ctx, void *udata) {
+	duk_double_t dvals[8];
+	duk_int32_t ivals[8];
+	duk_size_t n;
+
+	(void) udata;
+
+	/* Gap is looked up from the prototype, non-numbers are coerced.
+	 * The valueOf() side effect shrinks the array; the initial length
+	 * still decides the element count.
+	 */
+	duk_eval_string(ctx,
+	    "(function () {\n"
+	    "    Array.prototype[3] = 2;\n"
+	    "    var arr = [ 1, '7', 'foo', , { valueOf: function () { print('valueOf called'); arr.length = 1; return 0; } }, 6 ];\n"
+	    "    return arr;\n"
+	    "})()");
+	n = duk_get_array_doubles(ctx, -1, 0, dvals, 8);
+	print_doubles(n, dvals);
+	duk_eval_string_noresult(ctx, "delete Array.prototype[3];");
+	duk_pop(ctx);
+
+	duk_eval_string(ctx, "[ 4294967295, 0.9, 1.9 ]");
+	n = duk_get_array_int32s(ctx, -1, 0, ivals, 8);
+	printf("n=%lu: %ld %ld %ld\n", (unsigned long) n, (long) ivals[0], (long) ivals[1], (long) ivals[2]);
+	duk_pop(ctx);
+
+	printf("final top: %ld\n", (long) duk_get_top(ctx));
+	return 0;
+}
+
+static duk_ret_t test_get_arraylike(duk_context *ctx, void *udata) {
+	duk_double_t dvals[8];
+	duk_size_t n;
+
+	(void) udata;
+
+	duk_eval_string(ctx, "({ length: 3, 0: 10, 1: 20, 2: 30 })");
+	n = duk_get_array_doubles(ctx, -1, 0, dvals, 8);
+	print_doubles(n, dvals);
+	duk_pop(ctx);
+
+	duk_eval_string(ctx, "new Float64Array([ 0.5, -1 ])");
+	n = duk_get_array_doubles(ctx, -1, 0, dvals, 8);
+	print_doubles(n, dvals);
+	duk_pop(ctx);
+
+	printf("final top: %ld\n", (long) duk_get_top(ctx));
+	return 0;
+}
+
+static duk_ret_t test_get_nonobject(duk_context *ctx, void *udata) {
+	duk_double_t dvals[8];
+
+	(void) udata;
+
+	duk_push_int(ctx, 123);
+	(void) duk_get_array_doubles(ctx, -1, 0, dvals, 8);
+	printf("never here\n");
+	return 0;
+}
+
+void test(duk_context *ctx) {
+	TEST_SAFE_CALL(test_push);
+	TEST_SAFE_CALL(test_get_dense);
+	TEST_SAFE_CALL(test_get_coerce);
+	TEST_SAFE_CALL(test_get_arraylike);
+	TEST_SAFE_CALL(test_get_nonobject);
+}
@@ -0,0 +1,260 @@
+/*
+ *  duk_put_field_list() and duk_get_field_list()
+ */
+
+#include <stddef.h>  /* offsetof */
+
+/*===
+*** test_1 (duk_safe_call)
+{"enabled":true,"count":-123,"flags":4000000000,"id":-2147483648,"mask":4294967295,"ratio":0.25,"name":"foo","nothing":null}
+true
+true
+final top: 1
+==> rc=0, result='undefined'
+*** test_2 (duk_safe_call)
+count: 8
+enabled=1 count=42 flags=7 id=-1 mask=4294967295 ratio=1.5 name=bar ptr_ok=1
+untouched: 99 default
+final top: 1
+==> rc=0, result='undefined'
+*** test_3 (duk_safe_call)
+setter called: 12
+getter called
+count=321
+final top: 1
+==> rc=0, result='undefined'
+*** test_4 (duk_safe_call)
+==> rc=1, result='TypeError: invalid args'
+*** test_5 (duk_safe_call)
+{"name":"foo","foo":"x"}
+{"name":null,"foo":"x"}
+final top: 1
+==> rc=0, result='undefined'
+*** test_6 (duk_safe_call)
+own data: count=1 name=plain
+getter: count=1 name=NULL
+proxy: count=1 name=NULL
+inherited: count=1 name=NULL
+getter undefined: count=0 name=default
+final top: 1
+==> rc=0, result='undefined'
+===*/
+
+typedef struct {
+	duk_bool_t enabled;
+	duk_int_t count;
+	duk_uint_t flags;
+	duk_int32_t id;
+	duk_uint32_t mask;
+	duk_double_t ratio;
+	const char *name;
+	const char *nothing;
+	void *ptr;
+} my_struct;
+
+static const duk_field_list_entry my_fields[] = {
+	{ "enabled", DUK_FIELD_BOOLEAN, offsetof(my_struct, enabled) },
+	{ "count", DUK_FIELD_INT, offsetof(my_struct, count) },
+	{ "flags", DUK_FIELD_UINT, offsetof(my_struct, flags) },
+	{ "id", DUK_FIELD_INT32, offsetof(my_struct, id) },
+	{ "mask", DUK_FIELD_UINT32, offsetof(my_struct, mask) },
+	{ "ratio", DUK_FIELD_DOUBLE, offsetof(my_struct, ratio) },
+	{ "name", DUK_FIELD_STRING, offsetof(my_struct, name) },
+	{ "nothing", DUK_FIELD_STRING, offsetof(my_struct, nothing) },
+	{ "ptr", DUK_FIELD_POINTER, offsetof(my_struct, ptr) },
+	{ NULL, 0, 0 }
+};
+
+static const duk_field_list_entry my_count_field[] = {
+	{ "count", DUK_FIELD_INT, offsetof(my_struct, count) },
+	{ NULL, 0, 0 }
+};
+
+static const duk_field_list_entry my_name_field[] = {
+	{ "name", DUK_FIELD_STRING, offsetof(my_struct, name) },
+	{ NULL, 0, 0 }
+};
+
+static const duk_field_list_entry my_bad_field[] = {
+	{ "count", 0xdeadU, offsetof(my_struct, count) },
+	{ NULL, 0, 0 }
+};
+
+/* Build an object from a struct. */
+static duk_ret_t test_1(duk_context *ctx, void *udata) {
+	my_struct s;
+
+	(void) udata;
+
+	memset((void *) &s, 0, sizeof(s));
+	s.enabled = 1;
+	s.count = -123;
+	s.flags = 4000000000UL;
+	s.id = (duk_int32_t) (-2147483647L - 1L);
+	s.mask = 0xffffffffUL;
+	s.ratio = 0.25;
+	s.name = "foo";
+	s.nothing = NULL;
+	s.ptr = (void *) &s;
+
+	duk_push_string(ctx, "dummy");  /* just for offset */
+	duk_push_object(ctx);
+	duk_put_field_list(ctx, -1, my_fields, (const void *) &s);
+
+	duk_dup_top(ctx);
+	duk_json_encode(ctx, -1);  /* pointer is omitted by JSON */
+	printf("%s\n", duk_get_string(ctx, -1));
+	duk_pop(ctx);
+
+	duk_get_prop_string(ctx, -1, "ptr");
+	printf("%s\n", duk_get_pointer(ctx, -1) == (void *) &s ? "true" : "false");
+	duk_pop(ctx);
+
+	/* Fastint compatible values are fastint downgraded. */
+	duk_push_global_object(ctx);
+	duk_dup(ctx, -2);
+	duk_put_prop_string(ctx, -2, "obj");
+	duk_pop(ctx);
+	duk_eval_string_noresult(ctx, "print(Duktape.info(obj.count).itag === Duktape.info(obj.id).itag)");
+
+	duk_pop(ctx);
+	printf("final top: %ld\n", (long) duk_get_top(ctx));
+	return 0;
+}
+
+/* Read back into a struct, with coercion and defaults for missing fields. */
+static duk_ret_t test_2(duk_context *ctx, void *udata) {
+	my_struct s;
+	duk_uint_t count;
+
+	(void) udata;
+
+	memset((void *) &s, 0, sizeof(s));
+	s.count = 99;
+	s.name = "default";
+
+	duk_push_string(ctx, "dummy");  /* just for offset */
+	duk_push_pointer(ctx, (void *) &s);
+	duk_put_global_string(ctx, "ptrValue");
+	duk_eval_string(ctx, "({ enabled: 'yes', count: 42.9, flags: '7', id: -1, mask: -1, ratio: 1.5, name: 'bar', ptr: ptrValue })");
+	count = duk_get_field_list(ctx, -1, my_fields, (void *) &s);
+	printf("count: %lu\n", (unsigned long) count);
+	printf("enabled=%ld count=%ld flags=%lu id=%ld mask=%lu ratio=%g name=%s ptr_ok=%d\n",
+	       (long) s.enabled, (long) s.count, (unsigned long) s.flags, (long) s.id,
+	       (unsigned long) s.mask, (double) s.ratio, s.name, (int) (s.ptr == (void *) &s));
+	duk_pop(ctx);
+
+	s.count = 99;
+	s.name = "default";
+	duk_push_object(ctx);
+	(void) duk_get_field_list(ctx, -1, my_fields, (void *) &s);
+	printf("untouched: %ld %s\n", (long) s.count, s.name);
+	duk_pop(ctx);
+
+	printf("final top: %ld\n", (long) duk_get_top(ctx));
+	return 0;
+}
+
+/* Accessors are invoked like for ordinary property reads and writes. */
+static duk_ret_t test_3(duk_context *ctx, void *udata) {
+	my_struct s;
+
+	(void) udata;
+
+	memset((void *) &s, 0, sizeof(s));
+	s.count = 12;
+
+	duk_push_string(ctx, "dummy");  /* just for offset */
+	duk_eval_string(ctx,
+	    "({ set count(v) { print('setter called: ' + v); },\n"
+	    "   get count() { print('getter called'); return 321; } })");
+	duk_put_field_list(ctx, -1, my_count_field, (const void *) &s);
+	(void) duk_get_field_list(ctx, -1, my_count_field, (void *) &s);
+	printf("count=%ld\n", (long) s.count);
+	duk_pop(ctx);
+
+	printf("final top: %ld\n", (long) duk_get_top(ctx));
+	return 0;
+}
+
+/* Unknown field type is an error. */
+static duk_ret_t test_4(duk_context *ctx, void *udata) {
+	my_struct s;
+
+	(void) udata;
+
+	memset((void *) &s, 0, sizeof(s));
+	duk_push_object(ctx);
+	duk_put_field_list(ctx, -1, my_bad_field, (const void *) &s);
+	printf("never here\n");
+	return 0;
+}
+
+/* String field overwriting an existing property whose name differs from
+ * the new value.
+ */
+static duk_ret_t test_5(duk_context *ctx, void *udata) {
+	my_struct s;
+
+	(void) udata;
+
+	memset((void *) &s, 0, sizeof(s));
+	s.name = "foo";
+
+	duk_push_string(ctx, "dummy");  /* just for offset */
+	duk_eval_string(ctx, "({ name: 'old', foo: 'x' })");
+	duk_put_field_list(ctx, -1, my_name_field, (const void *) &s);
+	duk_dup_top(ctx);
+	duk_json_encode(ctx, -1);
+	printf("%s\n", duk_get_string(ctx, -1));
+	duk_pop(ctx);
+
+	s.name = NULL;
+	duk_put_field_list(ctx, -1, my_name_field, (const void *) &s);
+	duk_dup_top(ctx);
+	duk_json_encode(ctx, -1);
+	printf("%s\n", duk_get_string(ctx, -1));
+	duk_pop_2(ctx);
+
+	printf("final top: %ld\n", (long) duk_get_top(ctx));
+	return 0;
+}
+
+/* String fields are only read from own data properties: a string returned
+ * by a getter or a Proxy trap would not be reachable after the call.
+ */
+static void read_name(duk_context *ctx, const char *desc, const char *code) {
+	my_struct s;
+	duk_uint_t count;
+
+	memset((void *) &s, 0, sizeof(s));
+	s.name = "default";
+	duk_eval_string(ctx, code);
+	count = duk_get_field_list(ctx, -1, my_name_field, (void *) &s);
+	duk_gc(ctx, 0);  /* object keeps own data property values reachable */
+	printf("%s: count=%lu name=%s\n", desc, (unsigned long) count, s.name ? s.name : "NULL");
+	duk_pop(ctx);
+}
+
+static duk_ret_t test_6(duk_context *ctx, void *udata) {
+	(void) udata;
+
+	duk_push_string(ctx, "dummy");  /* just for offset */
+	read_name(ctx, "own data", "({ name: 'pla' + 'in' })");
+	read_name(ctx, "getter", "({ get name() { return 'fresh' + Math.random(); } })");
+	read_name(ctx, "proxy", "new Proxy({}, { get: function () { return 'trap' + Math.random(); } })");
+	read_name(ctx, "inherited", "Object.create({ name: 'inherited' })");
+	read_name(ctx, "getter undefined", "({ get name() { return undefined; } })");
+
+	printf("final top: %ld\n", (long) duk_get_top(ctx));
+	return 0;
+}
+
+void test(duk_context *ctx) {
+	TEST_SAFE_CALL(test_1);
+	TEST_SAFE_CALL(test_2);
+	TEST_SAFE_CALL(test_3);
+	TEST_SAFE_CALL(test_4);
+	TEST_SAFE_CALL(test_5);
+	TEST_SAFE_CALL(test_6);
+}
@@ -0,0 +1,108 @@
+#!/bin/sh
+#
+#  ROM build test for application bytecode in user built-ins: a function
+#  compiled with 'duk -c' is placed into ROM using a 'bytecode' property
+#  value and called from ECMAScript.
+#
+
+set -e
+
+TESTDIR=/tmp/duk-configure-rom-bytecode-test
+CCOPTS="-std=c99 -O2 -Wall -Iexamples/cmdline -Iextras/print-alert -DDUK_CMDLINE_PRINTALERT_SUPPORT"
+CCSRCS="examples/cmdline/duk_cmdline.c extras/print-alert/duk_print_alert.c"
+
+reinit() {
+	if [ ! -d /tmp ]; then
+		echo "This script expects /tmp to exist"
+		exit 1
+	fi
+
+	rm -rf $TESTDIR
+	mkdir $TESTDIR
+}
+
+reinit
+
+# Default RAM build for compiling the application bytecode.
+python tools/configure.py \
+	--output-directory $TESTDIR/prep-ram
+gcc -o $TESTDIR/duk-ram -I$TESTDIR/prep-ram $CCOPTS $TESTDIR/prep-ram/duktape.c $CCSRCS -lm
+
+cat > $TESTDIR/app.js <<'EOT'
+// Runs in the global environment when romApp() is called.
+var appCalls = (typeof appCalls === 'number' ? appCalls : 0) + 1;
+
+function makeCounter(start) {
+    var count = start;
+    return function (step) {
+        count += step;
+        return count;
+    };
+}
+
+function appSum(arr) {
+    var i, res = 0;
+    for (i = 0; i < arr.length; i++) {
+        res += arr[i];
+    }
+    return res + appBase;
+}
+EOT
+$TESTDIR/duk-ram -c $TESTDIR/app.bin $TESTDIR/app.js
+
+cat > $TESTDIR/builtins.yaml <<EOT
+objects:
+  - id: bi_global
+    modify: true
+    properties:
+      - key: "romApp"
+        value:
+          type: bytecode
+          filename: "$TESTDIR/app.bin"
+        attributes: wc
+EOT
+
+# Union initializers don't work for an unpacked duk_tval, so disable them
+# to allow the test to run on 64-bit hosts.
+python tools/configure.py \
+	--output-directory $TESTDIR/prep-rom \
+	--rom-support --rom-auto-lightfunc \
+	--builtin-file $TESTDIR/builtins.yaml \
+	-DDUK_USE_ROM_STRINGS -DDUK_USE_ROM_OBJECTS -DDUK_USE_ROM_GLOBAL_INHERIT \
+	-UDUK_USE_HSTRING_ARRIDX -UDUK_USE_UNION_INITIALIZERS
+gcc -o $TESTDIR/duk-rom -I$TESTDIR/prep-rom $CCOPTS $TESTDIR/prep-rom/duktape.c $CCSRCS -lm
+
+cat > $TESTDIR/test.js <<'EOT'
+var appBase = 100;
+print(typeof romApp, typeof makeCounter);
+romApp();
+print(typeof makeCounter, typeof appSum, appCalls);
+print(appSum([ 1, 2, 3 ]));
+appBase = 1000;
+print(appSum([ 1, 2, 3 ]));
+var c1 = makeCounter(10);
+var c2 = makeCounter(20);
+print(c1(1), c1(2), c2(5), c1(3));
+c1.extra = 'extensible';
+print(c1.extra, c1 === c2);
+romApp();
+print(appCalls);
+EOT
+cat > $TESTDIR/expect.txt <<'EOT'
+function undefined
+function function 1
+106
+1006
+11 13 25 16
+extensible false
+2
+EOT
+
+$TESTDIR/duk-rom $TESTDIR/test.js > $TESTDIR/output.txt
+if ! cmp -s $TESTDIR/expect.txt $TESTDIR/output.txt; then
+	echo "Unexpected output from ROM bytecode test:"
+	diff -u $TESTDIR/expect.txt $TESTDIR/output.txt || true
+	exit 1
+fi
+
+echo "Done."
@@ -0,0 +1,145 @@
+/*
+ *  Array.prototype fast paths for dense arrays (reverse, slice, indexOf,
+ *  concat, iteration, reduce) must match the generic algorithm for gaps,
+ *  inherited index properties, and side effects which modify the array.
+ */
+
+/*===
+reverse
+[null,[4],{"three":3},"two",1] len=5 keys=0,1,2,3,4
+[] len=0 keys= [1] len=1 keys=0
+[4,3,null,1] len=4 keys=0,1,3
+[3,"inh",1] len=3 keys=0,2 false
+[3,2,1] len=3 keys=0,1,2
+slice
+["a","b","c","d","e"] len=5 keys=0,1,2,3,4 ["b","c"] len=2 keys=0,1 ["d","e"] len=2 keys=0,1 [] len=0 keys=
+["a",null,"c"] len=3 keys=0,2
+["a","inh","c"] len=3 keys=0,1,2
+[1,2] len=2 keys=0,1
+[1,"changed",3] len=3 keys=0,1,2
+["x",null,"z"] len=3 keys=0,2
+indexOf
+0 8 1 -1 3 4 5 6 7 8 0
+-1
+1 1
+getter
+-1 0
+1 -1
+concat
+[1,null,3,4,5,6,[7]] len=7 keys=0,2,3,4,5,6
+[1,"inh",3,1,"inh",3] len=6 keys=0,1,2,3,4,5
+iteration
+["1!","2!","3!",null] len=4 keys=0,1,2
+[1,3] len=2 keys=0,1
+forEach 0 1
+forEach 2 3
+forEach 0 1
+forEach 1 inh
+forEach 2 3
+false true
+reduce
+10 4,3,2,1
+103
+bd3
+inhb1d3
+TypeError
+has 0
+get 0
+has 1
+get 1
+has 2
+get 2
+6
+===*/
+
+function show(a) {
+    var keys = Object.keys(a);
+    return JSON.stringify(a) + ' len=' + a.length + ' keys=' + keys.join(',');
+}
+
+print('reverse');
+var a = [ 1, 'two', { three: 3 }, [ 4 ], null ];
+print(show(a.reverse()));
+print(show([].reverse()), show([ 1 ].reverse()));
+a = [ 1, , 3, 4 ];
+print(show(a.reverse()));
+Array.prototype[1] = 'inh';
+a = [ 1, , 3 ];
+print(show(a.reverse()), a.hasOwnProperty(1));
+delete Array.prototype[1];
+a = [ 1, 2, 3 ];
+Object.defineProperty(a, 'length', { writable: false });
+print(show(a.reverse()));
+
+print('slice');
+a = [ 'a', 'b', 'c', 'd', 'e' ];
+print(show(a.slice()), show(a.slice(1, 3)), show(a.slice(-2)), show(a.slice(3, 1)));
+a = [ 'a', , 'c' ];
+print(show(a.slice()));
+Array.prototype[1] = 'inh';
+print(show(a.slice()));
+delete Array.prototype[1];
+a = [ 1, 2, 3, 4, 5 ];
+print(show(a.slice({ valueOf: function () { a.length = 2; return 0; } })));
+a = [ 1, 2, 3, 4, 5 ];
+print(show(a.slice(0, { valueOf: function () { a[1] = 'changed'; return 3; } })));
+var o = { length: 3, 0: 'x', 2: 'z' };
+print(show(Array.prototype.slice.call(o)));
+
+print('indexOf');
+a = [ 1, '1', NaN, 0, -0, null, undefined, 'foo', 1 ];
+print(a.indexOf(1), a.lastIndexOf(1), a.indexOf('1'), a.indexOf(NaN), a.indexOf(-0), a.lastIndexOf(0),
+      a.indexOf(null), a.indexOf(undefined), a.indexOf('fo' + 'o'), a.indexOf(1, 1), a.lastIndexOf(1, -2));
+a = [ 1, , 3 ];
+print(a.indexOf(undefined));
+Array.prototype[1] = 'inh';
+print(a.indexOf('inh'), a.lastIndexOf('inh'));
+delete Array.prototype[1];
+a = [ 1, 2, 3 ];
+Object.defineProperty(Array.prototype, '5', {
+    get: function () { print('getter'); a.length = 0; return 'gotten'; }, configurable: true
+});
+a.length = 10;
+print(a.indexOf(3, 3), a.length);
+delete Array.prototype[5];
+var obj = {};
+print([ 1, obj, 3 ].indexOf(obj), [ 1, obj, 3 ].indexOf({}));
+
+print('concat');
+a = [ 1, , 3 ];
+print(show(a.concat([ 4, 5 ], 6, [ [ 7 ] ])));
+Array.prototype[1] = 'inh';
+print(show(a.concat(a)));
+delete Array.prototype[1];
+
+print('iteration');
+a = [ 1, 2, 3, 4 ];
+print(show(a.map(function (v, i, arr) { if (i === 0) { arr[3] = 'mod'; arr.length = 3; } return v + '!'; })));
+a = [ 1, 2, 3, 4 ];
+print(show(a.filter(function (v, i, arr) { if (i === 0) { arr.pop(); } return v !== 2; })));
+a = [ 1, , 3 ];
+a.forEach(function (v, i) { print('forEach', i, v); });
+Array.prototype[1] = 'inh';
+a.forEach(function (v, i) { print('forEach', i, v); });
+delete Array.prototype[1];
+print([ 1, 2, 3 ].every(function (v) { return v < 3; }), [ 1, 2, 3 ].some(function (v) { return v > 2; }));
+
+print('reduce');
+a = [ 1, 2, 3, 4 ];
+print(a.reduce(function (acc, v) { return acc + v; }), a.reduceRight(function (acc, v) { return acc + ',' + v; }));
+print(a.reduce(function (acc, v, i, arr) { if (i === 1) { arr.length = 2; } return acc + v; }, 100));
+a = [ , 'b', , 'd' ];
+print(a.reduce(function (acc, v, i) { return acc + v + i; }));
+Array.prototype[0] = 'inh';
+print(a.reduce(function (acc, v, i) { return acc + v + i; }));
+delete Array.prototype[0];
+try {
+    [ , , ].reduce(function () {});
+} catch (e) {
+    print(e.name);
+}
+var p = new Proxy([ 1, 2, 3 ], {
+    has: function (t, k) { print('has', k); return k in t; },
+    get: function (t, k) { if (k !== 'length') { print('get', k); } return t[k]; }
+});
+print(Array.prototype.reduce.call(p, function (acc, v) { return acc + v; }));
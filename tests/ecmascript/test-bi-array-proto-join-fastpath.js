@@ -0,0 +1,69 @@
+/*
+ *  Array.prototype.join() fast path for dense arrays: element coercions
+ *  done without intermediate strings must match ToString(), and anything
+ *  else must go through the generic algorithm.
+ */
+
+/*===
+1,two,true,false,,,0,-123,4294967295,-4294967295
+4294967296|1.5|-1e+21|1e+21|NaN|Infinity|-Infinity|0.1
+abc a,b,c a true
+ 0 -
+foo,bar foonullbar 11232
+x/obj/1,2
+1,,3
+1,inh,3
+TypeError
+a+changed
+2 55357 56832 true
+äö—€—x
+60923 0,str1,true,3,str4,false,6,str7,true,9,s 4,false,9996,str9997,true,9999
+1,a,loc
+x..z
+a-b-c
+===*/
+
+print([ 1, 'two', true, false, null, undefined, -0, -123, 4294967295, -4294967295 ].join());
+print([ 4294967296, 1.5, -1e21, 1e21, NaN, Infinity, -Infinity, 0.1 ].join('|'));
+print([ 'a', 'b', 'c' ].join(''), [ 'a', 'b', 'c' ].join(), [ 'a' ].join('--'), [].join('x') === '');
+print([ '', '', '' ].join(''), [ '', '', '' ].join('').length, [ , , ].join('-'));
+print([ 'foo', 'bar' ].join(undefined), [ 'foo', 'bar' ].join(null), [ 1, 2 ].join(123));
+print([ 'x', { toString: function () { return 'obj'; } }, [ 1, 2 ] ].join('/'));
+
+// Gaps are looked up from the prototype.
+var a = [ 1, , 3 ];
+print(a.join());
+Array.prototype[1] = 'inh';
+print(a.join());
+delete Array.prototype[1];
+
+// Symbols throw.
+try {
+    [ 'a', Symbol('foo') ].join();
+} catch (e) {
+    print(e.name);
+}
+
+// Separator coercion happens before element reads.
+a = [ 'a', 'b' ];
+print(a.join({ toString: function () { a[1] = 'changed'; return '+'; } }));
+
+// Surrogate halves combine at join points.
+var s = [ '\ud83d', '\ude00' ].join('');
+print(s.length, s.charCodeAt(0), s.charCodeAt(1), s === '😀');
+
+// Non-ASCII and long strings.
+print([ 'äö', '€', 'x' ].join('—'));
+a = [];
+for (var i = 0; i < 10000; i++) {
+    a.push(i % 3 === 0 ? i : (i % 3 === 1 ? 'str' + i : (i % 2 === 0)));
+}
+var res = a.join(',');
+print(res.length, res.substring(0, 40), res.substring(res.length - 30));
+
+// toLocaleString() still calls element toLocaleString().
+print([ 1, 'a', { toLocaleString: function () { return 'loc'; } } ].toLocaleString());
+
+// Array-likes use the generic algorithm.
+print(Array.prototype.join.call({ length: 3, 0: 'x', 2: 'z' }, '.'));
+print(Array.prototype.join.call('abc', '-'));
@@ -0,0 +1,143 @@
+/*
+ *  shift(), unshift(), and splice() on dense arrays: the array part fast
+ *  paths must match the generic algorithm, including gaps, non-writable
+ *  length, non-extensible arrays, and argument coercion side effects.
+ */
+
+/*===
+basic shift
+1 [2,3,{"x":1},"foo"] len=4 keys=0,1,2,3
+2 [3,{"x":1},"foo"] len=3 keys=0,1,2
+3 [object Object] foo undefined [] len=0 keys=
+gaps
+1 [null,3,null,5] len=4 keys=1,3 false true
+undefined [3,null,5] len=3 keys=0,2 true
+unshift
+3 [1,2,3] len=3 keys=0,1,2
+5 ["x","y",1,2,3] len=5 keys=0,1,2,3,4
+3 [0,"x","y"] len=3 keys=0,1,2
+3 [0,null,2] len=3 keys=0,2 false
+queue churn
+1000 124750 500 {"v":500}
+0
+nonwritable length
+TypeError
+[2,3,null] len=3 keys=0,1
+TypeError
+[0,2,3] len=3 keys=0,1,2
+TypeError
+[2,3,null] len=3 keys=0,1
+non-extensible
+TypeError
+[1,2,3] len=3 keys=0,1,2
+1 [2,3] len=2 keys=0,1
+TypeError
+[2,3] len=2 keys=0,1
+[2] ["y",3] len=2 keys=0,1
+TypeError
+[null,null,3,4] len=4 keys=2,3 false
+TypeError
+[null,null,3,4] len=4 keys=2,3 false
+splice
+[2,3,"a"] -> [3,4,5] len=3 keys=0,1,2 | [1,2,"a",6,7,8] len=6 keys=0,1,2,3,4,5
+[2,3,"a","b","c","d"] -> [3,4,5] len=3 keys=0,1,2 | [1,2,"a","b","c","d",6,7,8] len=9 keys=0,1,2,3,4,5,6,7,8
+[2,3,"a","b","c"] -> [3,4,5] len=3 keys=0,1,2 | [1,2,"a","b","c",6,7,8] len=8 keys=0,1,2,3,4,5,6,7
+[-2] -> [7,8] len=2 keys=0,1 | [1,2,3,4,5,6] len=6 keys=0,1,2,3,4,5
+[0,0] -> [] len=0 keys= | [1,2,3,4,5,6,7,8] len=8 keys=0,1,2,3,4,5,6,7
+[8,0,"end"] -> [] len=0 keys= | [1,2,3,4,5,6,7,8,"end"] len=9 keys=0,1,2,3,4,5,6,7,8
+[1,2] -> [null,3] len=2 keys=1 | [1,null,5] len=3 keys=0,2
+[0,1,"x","y"] -> [1] len=1 keys=0 | ["x","y",null,3,null,5] len=6 keys=0,1,3,5
+[0,0,1,2,3] -> [] len=0 keys= | [1,2,3] len=3 keys=0,1,2
+[5,10] -> [5,6,7,8,9,10,11,12,13,14] len=10 keys=0,1,2,3,4,5,6,7,8,9 | [0,1,2,3,4,15,16,17,18,19] len=10 keys=0,1,2,3,4,5,6,7,8,9
+splice coercion side effect
+[2,null] len=2 keys=0 [1,null,null] len=3 keys=0
+[2] len=1 keys=0 [1,"x",3,4,5] len=5 keys=0,1,2,3,4
+===*/
+
+function dump(a) { return JSON.stringify(a) + ' len=' + a.length + ' keys=' + Object.keys(a).join(','); }
+
+print('basic shift');
+var a = [ 1, 2, 3, { x: 1 }, 'foo' ];
+print(a.shift(), dump(a));
+print(a.shift(), dump(a));
+print(a.shift(), a.shift(), a.shift(), a.shift(), dump(a));
+
+print('gaps');
+a = [ 1, , 3, , 5 ];
+print(a.shift(), dump(a), 0 in a, 1 in a);
+print(a.shift(), dump(a), 0 in a);
+
+print('unshift');
+a = [ 1, 2, 3 ];
+print(a.unshift(), dump(a));
+print(a.unshift('x', 'y'), dump(a));
+a.length = 2;
+print(a.unshift(0), dump(a));
+a = [ , 2 ];
+print(a.unshift(0), dump(a), 1 in a);
+
+print('queue churn');
+var q = [];
+var sum = 0;
+for (var i = 0; i < 1000; i++) {
+    q.push(i, { v: i });
+    if (i & 1) { sum += q.shift(); q.shift(); }
+}
+print(q.length, sum, q[0], JSON.stringify(q[1]));
+while (q.length > 0) { q.unshift(q.pop()); q.shift(); }
+print(q.length);
+
+print('nonwritable length');
+a = [ 1, 2, 3 ];
+Object.defineProperty(a, 'length', { writable: false });
+try { print(a.shift()); } catch (e) { print(e.name); }
+print(dump(a));
+try { print(a.unshift(0)); } catch (e) { print(e.name); }
+print(dump(a));
+try { print(JSON.stringify(a.splice(0, 1))); } catch (e) { print(e.name); }
+print(dump(a));
+
+print('non-extensible');
+a = [ 1, 2, 3 ];
+Object.preventExtensions(a);
+try { print(a.unshift(0)); } catch (e) { print(e.name); }
+print(dump(a));
+print(a.shift(), dump(a));
+try { print(JSON.stringify(a.splice(0, 0, 'x'))); } catch (e) { print(e.name); }
+print(dump(a));
+print(JSON.stringify(a.splice(0, 1, 'y')), dump(a));
+
+// Moving elements over gaps would create new own properties.
+a = [ 1, , 3, 4 ];
+Object.preventExtensions(a);
+try { print(a.shift()); } catch (e) { print(e.name); }
+print(dump(a), Object.isExtensible(a));
+a = [ 1, , 3, 4 ];
+Object.preventExtensions(a);
+try { print(JSON.stringify(a.splice(0, 1))); } catch (e) { print(e.name); }
+print(dump(a), Object.isExtensible(a));
+
+print('splice');
+function sp(arr, args) {
+    var r = Array.prototype.splice.apply(arr, args);
+    print(JSON.stringify(args), '->', dump(r), '|', dump(arr));
+}
+sp([1,2,3,4,5,6,7,8], [2, 3, 'a']);
+sp([1,2,3,4,5,6,7,8], [2, 3, 'a', 'b', 'c', 'd']);
+sp([1,2,3,4,5,6,7,8], [2, 3, 'a', 'b', 'c']);
+sp([1,2,3,4,5,6,7,8], [-2]);
+sp([1,2,3,4,5,6,7,8], [0, 0]);
+sp([1,2,3,4,5,6,7,8], [8, 0, 'end']);
+sp([1,,3,,5], [1, 2]);
+sp([1,,3,,5], [0, 1, 'x', 'y']);
+sp([], [0, 0, 1, 2, 3]);
+var big = []; for (i = 0; i < 20; i++) { big.push(i); }
+sp(big, [5, 10]);
+
+print('splice coercion side effect');
+a = [1, 2, 3, 4, 5];
+var r = a.splice({ valueOf: function () { a.length = 2; return 1; } }, 2);
+print(dump(r), dump(a));
+a = [1, 2, 3, 4, 5];
+r = a.splice(1, { valueOf: function () { a.push(6, 7, 8, 9, 10, 11, 12); return 1; } }, 'x');
+print(dump(r), dump(a));
@@ -0,0 +1,67 @@
+/*
+ *  URI and escape()/unescape() transforms copy runs of unchanged ASCII
+ *  as is; the result must match the per-codepoint algorithm at run
+ *  boundaries and for input which needs no changes at all.
+ */
+
+/*===
+true true true true
+true true true
+%20a%20b%20 %2Fa%3Fb%3Dc%26d%23 /a?b=c&d#
+%C3%A4x%E2%82%ACy%F0%9F%98%80z %E4x%u20ACy%uD83Dz
+ a/b?€z %23%2fAx
+Aa€b%u00 % x%4
+true true
+abc% URIError
+abc%4 URIError
+abc%C0%80 URIError
+abc%ED%A0%80 URIError
+URIError
+12890 23890 true
+20890 true
+123 null undefined true
+===*/
+
+// Input needing no changes.
+var s = 'abc-DEF_123.!~*\'()';
+print(encodeURI(s) === s, encodeURIComponent(s) === s, decodeURI(s) === s, decodeURIComponent(s) === s);
+print(escape('abc@*_+-./') === 'abc@*_+-./', unescape('abc') === 'abc', encodeURI('') === '');
+
+// Runs interleaved with escaped characters at both ends.
+print(encodeURI(' a b '), encodeURIComponent('/a?b=c&d#'), encodeURI('/a?b=c&d#'));
+print(encodeURIComponent('äx€y😀z'), escape('äx€y\ud83dz'));
+print(decodeURIComponent('%20a%2Fb%3F%e2%82%acz%'.slice(0, -1)), decodeURI('%23%2f%41x'));
+print(unescape('%41a%u20acb%u00'), unescape('%'), unescape('x%4'));
+
+// Non-ASCII input decodes as is.
+print(decodeURIComponent('äx%C3%A4') === 'äxä', unescape('ä%E4') === 'ää');
+
+// Errors are detected after a run.
+[ 'abc%', 'abc%4', 'abc%C0%80', 'abc%ED%A0%80' ].forEach(function (v) {
+    try {
+        decodeURIComponent(v);
+        print('no error');
+    } catch (e) {
+        print(v, e.name);
+    }
+});
+try {
+    encodeURIComponent('abc\ud800');
+    print('no error');
+} catch (e) {
+    print(e.name);
+}
+
+// Long mixed input.
+var parts = [];
+for (var i = 0; i < 1000; i++) {
+    parts.push('key' + i + '=val ' + String.fromCharCode(0xe0 + (i % 32)) + '&');
+}
+s = parts.join('');
+var enc = encodeURIComponent(s);
+print(s.length, enc.length, decodeURIComponent(enc) === s);
+enc = escape(s);
+print(enc.length, unescape(enc) === s);
+
+// Coercion.
+print(encodeURIComponent(123), decodeURI(null), escape(undefined), unescape(true));
@@ -0,0 +1,54 @@
+/*
+ *  Integer to string conversion goes through a digit pair formatter and
+ *  a weak integer string cache; results must match the generic algorithm
+ *  and cached strings must stay valid across garbage collection.
+ */
+
+/*===
+0 0 7 10 99 100 1000 65535 4294967294 4294967295 4294967296
+-1 -100 -4294967295 0.5 1e+21
+1234 true
+true true
+true
+9999 true
+"0":"1":"256":"512"
+===*/
+
+print(String(0), String(-0), String(7), String(10), String(99), String(100), String(1000),
+      String(65535), String(4294967294), String(4294967295), String(4294967296));
+print(String(-1), String(-100), String(-4294967295), String(0.5), String(1e21));
+
+// Same value converted repeatedly maps to an equal string.
+var a = String(1234);
+var b = '' + 1234;
+print(a, a === b);
+
+// Values colliding in the cache.
+print(String(1) + String(1 + 256) === '1257', String(257) === '257');
+
+// Cached strings may be freed; conversion still works afterwards.
+(function () {
+    var i, ok = true;
+    for (i = 0; i < 10000; i++) {
+        String(i);
+    }
+    Duktape.gc();
+    for (i = 0; i < 10000; i++) {
+        if (String(i) !== i.toFixed(0)) { ok = false; }
+        if (i % 1000 === 0) { Duktape.gc(); }
+    }
+    print(ok);
+})();
+(function () {
+    var o = {};
+    var i;
+    for (i = 0; i < 10000; i++) { o[i] = i; }
+    o.foo = 'bar';
+    Duktape.gc();
+    print(o[9999], Object.keys(o).length === 10001);
+})();
+
+// Numeric keys of a non-array object.
+var obj = { 0: 1 };
+obj[1] = 2; obj[256] = 3; obj[512] = 4;
+print(Object.keys(obj).map(function (k) { return JSON.stringify(k); }).join(':'));
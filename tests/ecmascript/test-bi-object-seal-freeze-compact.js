@@ -0,0 +1,74 @@
+/*
+ *  Seal and freeze compact the object in the same resize which abandons
+ *  the array part, and skip the resize when the object is already compact.
+ *  Property attributes must be updated in every case.
+ */
+
+/*===
+object literal
+true true false false
+1 10 true
+repeated freeze
+true true
+deleted keys
+b,d true true
+many properties
+200 199 true true
+array
+true true 10 false
+10 true
+sealed then frozen
+true false true
+false true
+===*/
+
+function desc(o, k) {
+    var d = Object.getOwnPropertyDescriptor(o, k);
+    return d.writable + ' ' + d.configurable;
+}
+
+print('object literal');
+var obj = { a: 1, b: 2, c: 3, d: 4, e: 5, f: 6, g: 7, h: 8, i: 9, j: 10 };
+Object.freeze(obj);
+print(Object.isFrozen(obj), Object.isSealed(obj), Object.isExtensible(obj), delete obj.a);
+obj.a = 100;
+print(obj.a, obj.j, Object.keys(obj).length === 10);
+
+print('repeated freeze');
+Object.freeze(obj);
+Object.seal(obj);
+print(Object.isFrozen(obj), obj.b === 2);
+
+print('deleted keys');
+obj = { a: 1, b: 2, c: 3, d: 4 };
+delete obj.a;
+delete obj.c;
+Object.freeze(obj);
+print(Object.keys(obj).join(), Object.isFrozen(obj), obj.d === 4);
+
+print('many properties');
+obj = {};
+for (var i = 0; i < 200; i++) { obj['k' + i] = i; }
+Object.freeze(obj);
+print(Object.keys(obj).length, obj.k199, Object.isFrozen(obj), desc(obj, 'k50') === 'false false');
+
+print('array');
+var arr = [ 1, 2, 3, 4, 5, 6, 7, 8, 9, 10 ];
+Object.freeze(arr);
+arr[0] = 100;
+arr.push = null;
+print(Object.isFrozen(arr), arr[0] === 1, arr.length, Object.isExtensible(arr));
+try {
+    arr.pop();
+} catch (e) {
+    print(arr.length, e instanceof TypeError);
+}
+
+print('sealed then frozen');
+obj = { x: 1, y: 2 };
+Object.seal(obj);
+obj.x = 10;
+print(obj.x === 10, Object.isFrozen(obj), Object.isSealed(obj));
+Object.freeze(obj);
+obj.x = 20;
+print(obj.x === 20, desc(obj, 'x') === 'false false');
@@ -0,0 +1,90 @@
+/*
+ *  Large key sets are ordered with a linear time radix sort: array index
+ *  keys ascending, then strings and symbols in insertion order.  Check the
+ *  result against a reference ordering for various key mixes.
+ */
+
+/*===
+10 true
+63 true
+64 true
+65 true
+300 true
+5000 true
+70000 true
+symbols true true
+for-in true
+inherited true
+json true
+===*/
+
+var seed = 1;
+function rnd(n) {
+    seed = (seed * 1103515245 + 12345) % 2147483648;
+    return seed % n;
+}
+
+function build(n) {
+    var obj = {};
+    var idx = [];
+    var str = [];
+    var i, k;
+    for (i = 0; i < n; i++) {
+        switch (rnd(4)) {
+        case 0:
+            k = rnd(300);
+            break;
+        case 1:
+            k = rnd(100000) * 40000 + rnd(40000);  // multiple radix digits
+            break;
+        case 2:
+            k = 4294967295 - rnd(3);  // 0xffffffff is not an index
+            break;
+        default:
+            k = 'str' + rnd(1000);
+        }
+        if (!Object.prototype.hasOwnProperty.call(obj, k)) {
+            obj[k] = i;
+            if (typeof k === 'number' && k < 4294967295) {
+                idx.push(k);
+            } else {
+                str.push(String(k));
+            }
+        }
+    }
+    idx.sort(function (a, b) { return a - b; });
+    return { obj: obj, expect: idx.map(String).concat(str) };
+}
+
+[ 10, 63, 64, 65, 300, 5000, 70000 ].forEach(function (n) {
+    var t = build(n);
+    print(n, Reflect.ownKeys(t.obj).join() === t.expect.join() &&
+          Object.keys(t.obj).join() === t.expect.join());
+});
+
+var t = build(1000);
+var s1 = Symbol('s1');
+var s2 = Symbol('s2');
+t.obj[s2] = 1;
+t.obj[123456] = 1;
+t.obj[s1] = 1;
+var keys = Reflect.ownKeys(t.obj);
+print('symbols', keys[keys.length - 2] === s2 && keys[keys.length - 1] === s1,
+      Object.getOwnPropertyNames(t.obj).length === keys.length - 2);
+
+t = build(2000);
+var res = [];
+for (var k in t.obj) { res.push(k); }
+print('for-in', res.join() === t.expect.join());
+
+var parent = build(500);
+var child = Object.create(parent.obj);
+child[7] = 1;
+child.own = 1;
+res = [];
+for (k in child) { res.push(k); }
+var expect = [ '7', 'own' ].concat(parent.expect.filter(function (k) { return k !== '7' && k !== 'own'; }));
+print('inherited', res.join() === expect.join());
+
+t = build(3000);
+print('json', Object.keys(JSON.parse(JSON.stringify(t.obj))).join() === t.expect.join());
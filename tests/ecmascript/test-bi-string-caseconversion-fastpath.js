@@ -0,0 +1,35 @@
+/*
+ *  Case conversion fast paths: ASCII-only input (including input which
+ *  doesn't change) and direct lookups for Latin, Greek, and Cyrillic must
+ *  match the generic rules, including 1:n and context sensitive cases.
+ */
+
+/*===
+HELLO, WORLD! 0123456789 @[`{ hello, world! 0123456789 @[`{
+ALREADY UPPER already lower true
+true string
+STRASSE ʼN 2
+όσος σας σ ΌΣΟΣ
+ПРИВЕТ МИР àéîõü ÿ Ÿ
+MIXED ASCII THEN ÄÖ THEN ASCII
+ß ԵՒ Ａ
+123 true
+TypeError
+===*/
+
+var s = 'Hello, World! 0123456789 @[`{';
+print(s.toUpperCase(), s.toLowerCase());
+print('ALREADY UPPER'.toUpperCase(), 'already lower'.toLowerCase(), ''.toUpperCase() === '');
+var u = 'abc';
+print(u.toLowerCase() === u, typeof u.toLowerCase());
+print('straße'.toUpperCase(), 'ŉ'.toUpperCase(), 'İ'.toLowerCase().length);
+print('ΌΣΟΣ ΣΑΣ Σ'.toLowerCase(), 'όσος'.toUpperCase());
+print('Привет Мир'.toUpperCase(), 'ÀÉÎÕÜ ÿ'.toLowerCase(), 'ÿ'.toUpperCase());
+print('mixed ASCII then ÄÖ then ascii'.toUpperCase());
+print('ẞ'.toLowerCase(), 'և'.toUpperCase(), 'ａ'.toUpperCase());
+print(String.prototype.toUpperCase.call(123), String.prototype.toLowerCase.call(true));
+try {
+    String.prototype.toUpperCase.call(null);
+} catch (e) {
+    print(e.name);
+}
@@ -0,0 +1,104 @@
+/*
+ *  TextEncoder.prototype.encodeInto()
+ */
+
+/*===
+function 2 true true true
+3 3 616263 0000
+1 3 e282ac0000
+1 3 e282ac
+0 0  00
+2 4 f09f9880
+0 0
+3 7 efbfbd41efbfbd
+1 1 61
+4 4 6e756c6c
+9 9 756e646566696e6564
+0 0 
+offset 2 2 00006869000000
+read,written
+TypeError
+TypeError
+===*/
+
+function hex(u8, n) {
+    var r = [];
+    for (var i = 0; i < (n === undefined ? u8.length : n); i++) {
+        r.push(('0' + u8[i].toString(16)).slice(-2));
+    }
+    return r.join('');
+}
+
+function test() {
+    var enc = new TextEncoder();
+    var pd = Object.getOwnPropertyDescriptor(TextEncoder.prototype, 'encodeInto');
+    var u8, res;
+
+    print(typeof pd.value, pd.value.length, pd.writable, pd.enumerable, pd.configurable);
+
+    // Fits with room to spare.
+    u8 = new Uint8Array(5);
+    res = enc.encodeInto('abc', u8);
+    print(res.read, res.written, hex(u8, res.written), hex(u8.subarray(res.written)));
+
+    // Partial sequences are never written.
+    u8 = new Uint8Array(5);
+    res = enc.encodeInto('€€', u8);
+    print(res.read, res.written, hex(u8));
+    u8 = new Uint8Array(3);
+    res = enc.encodeInto('€€', u8);
+    print(res.read, res.written, hex(u8, res.written));
+    u8 = new Uint8Array(1);
+    res = enc.encodeInto('ä', u8);
+    print(res.read, res.written, hex(u8, res.written), hex(u8));
+
+    // Non-BMP codepoints count as two UTF-16 code units.
+    u8 = new Uint8Array(4);
+    res = enc.encodeInto('😀', u8);
+    print(res.read, res.written, hex(u8));
+    res = enc.encodeInto('x', new Uint8Array(0));
+    print(res.read, res.written);
+
+    // Unpaired surrogates become U+FFFD.
+    u8 = new Uint8Array(16);
+    res = enc.encodeInto('\ud83dA\ude00', u8);
+    print(res.read, res.written, hex(u8, res.written));
+
+    u8 = new Uint8Array(1);
+    res = enc.encodeInto('abc', u8);
+    print(res.read, res.written, hex(u8));
+
+    // Source is coerced with ToString().
+    u8 = new Uint8Array(9);
+    res = enc.encodeInto(null, u8);
+    print(res.read, res.written, hex(u8, res.written));
+    res = enc.encodeInto(undefined, u8);
+    print(res.read, res.written, hex(u8));
+    res = enc.encodeInto('', u8);
+    print(res.read, res.written, hex(u8, res.written));
+
+    // Views write at their offset.
+    u8 = new Uint8Array(7);
+    res = enc.encodeInto('hi', u8.subarray(2, 4));
+    print('offset', res.read, res.written, hex(u8));
+
+    print(Object.keys(res).join(','));
+
+    // Destination must be a buffer.
+    try {
+        enc.encodeInto('abc', [ 0, 0, 0 ]);
+    } catch (e) {
+        print(e.name);
+    }
+    try {
+        enc.encodeInto('abc');
+    } catch (e) {
+        print(e.name);
+    }
+}
+
+try {
+    test();
+} catch (e) {
+    print(e.stack || e);
+}
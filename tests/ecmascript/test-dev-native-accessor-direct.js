@@ -0,0 +1,143 @@
+/*
+ *  Simple built-in accessors (typed array .byteLength etc, Error.prototype
+ *  .stack etc, native function .length and .name) are called directly
+ *  without an activation when DUK_USE_NATIVE_ACCESSOR_FASTPATH is enabled.
+ *  Check that results, errors thrown by such accessors, and value stack
+ *  state around them work like normal calls.
+ */
+
+/*===
+typed array
+16 4 8 true
+2 4
+12 0 12
+100 12 1216
+TypeError
+TypeError
+after errors 1 2 3
+error
+number string
+true
+custom message
+string true
+URIError: from toString
+own stack: replaced false
+own fileName: dummy
+own lineNumber: 123
+native function
+2 number
+string
+script accessor
+script getter 123
+script setter 234
+getter 345
+done
+===*/
+
+function typedArrayTest() {
+    var buf = new ArrayBuffer(16);
+    var u8 = new Uint8Array(buf, 4, 8);
+    var u16 = new Uint16Array(buf, 4, 2);
+    var i, a = 1, b = 2, c = 3, sum = 0;
+
+    print(u8.buffer.byteLength, u8.byteOffset, u8.byteLength, u8.buffer === buf);
+    print(u16.length, u16.byteLength);
+
+    var dv = new DataView(buf, 2, 12);
+    print(dv.byteLength, new Uint8Array(4).byteOffset, u8.buffer.byteLength - dv.byteOffset - 2);
+
+    // Values mixed with registers in a loop.
+    for (i = 0; i < 100; i++) {
+        sum += u8.byteLength + u8.byteOffset;
+    }
+    print(i, u8.byteLength + a + b + c - 2, sum + a + b + c + 10);
+
+    // Getter throws for a non-buffer 'this'; value stack must be intact
+    // for the catcher and for code after it.
+    try {
+        print(Object.create(Uint8Array.prototype).byteLength);
+    } catch (e) {
+        print(e.name);
+    }
+    function inner() {
+        var obj = Object.create(Uint8Array.prototype);
+        try {
+            return obj.byteOffset;
+        } finally {
+            a = 1;
+        }
+    }
+    try {
+        inner();
+    } catch (e) {
+        print(e.name);
+    }
+    print('after errors', a, b, c);
+}
+
+function errorTest() {
+    var err = new Error('test');
+    print(typeof err.lineNumber, typeof err.fileName);
+    print(typeof err.stack === 'string' && err.stack.indexOf('test') >= 0);
+
+    // Stack getter ToString() coerces the error which may call script code.
+    var err2 = new Error('dummy');
+    err2.toString = function () { return 'custom message'; };
+    print(err2.stack.split('\n')[0]);
+    print(typeof err2.stack, err2.stack === err2.stack);
+
+    var err3 = new Error('dummy');
+    err3.toString = function () { throw new URIError('from toString'); };
+    try {
+        print(err3.stack);
+    } catch (e) {
+        print(String(e));
+    }
+
+    // Setters create own properties.
+    var err4 = new Error('dummy');
+    err4.stack = 'replaced';
+    print('own stack:', err4.stack, Object.getOwnPropertyDescriptor(err4, 'stack').enumerable);
+    err4.fileName = 'dummy';
+    print('own fileName:', err4.fileName);
+    err4.lineNumber = 123;
+    print('own lineNumber:', err4.lineNumber);
+}
+
+function nativeFunctionTest() {
+    print(Math.max.length, typeof Math.max.length);
+    print(typeof Math.max.name);
+}
+
+function scriptAccessorTest() {
+    var val;
+    var obj = {
+        get x() { return 'script getter ' + this.y; },
+        set x(v) { val = 'script setter ' + v; },
+        y: 123
+    };
+    print(obj.x);
+    obj.x = 234;
+    print(val);
+
+    // Script getter inherited from a typed array (the getter is looked up
+    // along the prototype chain, not from the built-in).
+    var sub = Object.create(new Uint8Array(4));
+    Object.defineProperty(sub, 'foo', { get: function () { return 'getter ' + 345; } });
+    print(sub.foo);
+}
+
+try {
+    print('typed array');
+    typedArrayTest();
+    print('error');
+    errorTest();
+    print('native function');
+    nativeFunctionTest();
+    print('script accessor');
+    scriptAccessorTest();
+} catch (e) {
+    print(e.stack || e);
+}
+
+print('done');
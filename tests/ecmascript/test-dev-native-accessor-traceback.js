@@ -0,0 +1,57 @@
+/*
+ *  With DUK_USE_NATIVE_ACCESSOR_FASTPATH simple built-in accessors are
+ *  called without an activation, so an error thrown by such an accessor
+ *  has no traceback line for the accessor itself: the internal throw site
+ *  is followed directly by the calling ECMAScript function.  Script
+ *  accessors still get an activation.
+ */
+
+/*---
+{
+    "custom": true,
+    "comment": "traceback shape depends on DUK_USE_NATIVE_ACCESSOR_FASTPATH"
+}
+---*/
+
+/*===
+native accessor
+TypeError: not buffer
+    at [anon] () internal
+    at nativeGetter ()
+    at global () preventsyield
+script accessor
+Error: from getter
+    at foo () strict preventsyield
+    at scriptGetter ()
+    at global () preventsyield
+===*/
+
+function printStack(e) {
+    // Drop file/line information, which depends on the build.
+    print(e.stack.split('\n').map(function (line) {
+        return line.replace(/\(.*?\)/, '()');
+    }).join('\n'));
+}
+
+function nativeGetter() {
+    return Object.create(Uint8Array.prototype).byteLength;
+}
+
+function scriptGetter() {
+    var obj = { get foo() { 'use strict'; throw new Error('from getter'); } };
+    return obj.foo;
+}
+
+print('native accessor');
+try {
+    nativeGetter();
+} catch (e) {
+    printStack(e);
+}
+
+print('script accessor');
+try {
+    scriptGetter();
+} catch (e) {
+    printStack(e);
+}
@@ -0,0 +1,251 @@
+/*
+ *  Inherited property reads go through a prototype chain lookup cache when
+ *  DUK_USE_PROTOCACHE_SIZE is enabled.  Check that cached lookups see all
+ *  changes to the objects on the chain.
+ */
+
+/*===
+basic
+A.m A.m B.m C.m
+undefined undefined
+shadowing
+A.m B.m own
+C.m
+delete
+B.m A.m
+undefined
+A.m
+negative
+undefined undefined
+added added
+undefined
+setPrototypeOf
+A.m other
+undefined
+__proto__ B.m
+defineProperty
+data
+getter via 1
+setter 123
+A.m
+primitives
+trim
+foo
+true
+freed objects
+m0 m1 m2 m3 m4 m5 m6 m7 m8 m9
+keys
+v0 v1 v2 v3 v4 v5 v6 v7 v8 v9
+instanceof
+true true true false
+false
+true
+true true
+custom true false
+true
+false
+done
+===*/
+
+function makeChain() {
+    function A() {}
+    A.prototype.m = function () { return 'A.m'; };
+    A.prototype.onlyA = 'A.m';
+    function B() {}
+    B.prototype = Object.create(A.prototype);
+    function C() {}
+    C.prototype = Object.create(B.prototype);
+    return { A: A, B: B, C: C };
+}
+
+function basicTest() {
+    var t = makeChain();
+    var c = new t.C();
+    var i, res = [];
+
+    for (i = 0; i < 3; i++) {
+        res.push(c.m());
+    }
+    t.B.prototype.m = function () { return 'B.m'; };
+    res.push(c.m());
+    t.C.prototype.m = function () { return 'C.m'; };
+    res = res.slice(1);
+    res.push(c.m());
+    print(res.join(' '));
+    print(c.noSuch, c.noSuch);
+}
+
+function shadowingTest() {
+    var t = makeChain();
+    var c1 = new t.C();
+    var c2 = new t.C();
+    var res = [];
+
+    res.push(c1.m());
+    t.B.prototype.m = function () { return 'B.m'; };
+    res.push(c1.m());
+    c2.m = function () { return 'own'; };
+    res.push(c2.m());
+    print(res.join(' '));
+
+    // Shadowing on the first prototype (the cache start object).
+    t.C.prototype.m = function () { return 'C.m'; };
+    print(c1.m());
+}
+
+function deleteTest() {
+    var t = makeChain();
+    var c = new t.C();
+
+    t.B.prototype.m = function () { return 'B.m'; };
+    print(c.m(), (delete t.B.prototype.m, c.m()));
+
+    // Delete at the holder.
+    delete t.A.prototype.m;
+    print(c.m);
+
+    t.A.prototype.m = function () { return 'A.m'; };
+    print(c.m());
+}
+
+function negativeTest() {
+    var t = makeChain();
+    var c = new t.C();
+
+    print(c.later, c.later);
+    t.A.prototype.later = 'added';
+    print(c.later, c.later);
+    t.A.prototype.later = undefined;
+    delete t.A.prototype.later;
+    Object.prototype.later2 = 1;
+    delete Object.prototype.later2;
+    print(c.later2);
+}
+
+function setPrototypeOfTest() {
+    var t = makeChain();
+    var c = new t.C();
+    var other = { m: function () { return 'other'; } };
+
+    print(c.m(), (Object.setPrototypeOf(t.B.prototype, other), c.m()));
+    Object.setPrototypeOf(t.B.prototype, null);
+    print(c.onlyA);
+
+    var x = Object.create(t.A.prototype);
+    x.m();
+    x.__proto__ = { m: function () { return 'B.m'; } };
+    print('__proto__', x.m());
+}
+
+function definePropertyTest() {
+    var t = makeChain();
+    var c = new t.C();
+    var setterVal;
+
+    Object.defineProperty(t.B.prototype, 'p', { value: 'data', configurable: true });
+    print(c.p);
+    Object.defineProperty(t.C.prototype, 'p', {
+        get: function () { return 'getter via ' + (this === c ? 1 : 0); },
+        set: function (v) { setterVal = v; },
+        configurable: true
+    });
+    print(c.p);
+    c.p = 123;
+    print('setter', setterVal);
+
+    // Same key re-defined on the holder keeps the holder.
+    Object.defineProperty(t.A.prototype, 'm', { value: function () { return 'A.m'; } });
+    print(c.m());
+}
+
+function primitivesTest() {
+    print('  trim  '.trim());
+    String.prototype.foo = function () { return 'foo'; };
+    print('x'.foo());
+    delete String.prototype.foo;
+    print(typeof 'x'.foo === 'undefined');
+}
+
+function freedObjectsTest() {
+    // Prototype objects are freed and their addresses may be reused by
+    // new prototypes; results must not come from stale entries.
+    var i, res = [];
+
+    for (i = 0; i < 10; i++) {
+        (function (n) {
+            var proto = { m: function () { return 'm' + n; } };
+            var mid = Object.create(proto);
+            var obj = Object.create(mid);
+            res.push(obj.m());
+        })(i);
+    }
+    print(res.join(' '));
+}
+
+function keysTest() {
+    // Computed keys are freed after use, and new keys may reuse their
+    // addresses.
+    var proto = {};
+    var obj = Object.create(Object.create(proto));
+    var i, res = [];
+
+    for (i = 0; i < 10; i++) {
+        proto['key' + i] = 'v' + i;
+    }
+    for (i = 0; i < 10; i++) {
+        res.push(obj['key' + i]);
+    }
+    print(res.join(' '));
+}
+
+function instanceofTest() {
+    var t = makeChain();
+    var c = new t.C();
+    var b = new t.B();
+
+    print(c instanceof t.A, c instanceof t.B, c instanceof t.C, b instanceof t.C);
+    Object.setPrototypeOf(c, Object.prototype);
+    print(c instanceof t.A);
+    Object.setPrototypeOf(c, t.C.prototype);
+    print(c instanceof t.A);
+
+    // Bound function.
+    var BoundA = t.A.bind(null);
+    print(c instanceof BoundA, new t.A() instanceof BoundA);
+
+    // Symbol.hasInstance defined after the built-in one has been used.
+    Object.defineProperty(t.B, Symbol.hasInstance, {
+        value: function (v) { print('custom', this === t.B, v === c); return true; },
+        configurable: true
+    });
+    print({} instanceof t.B);
+    delete t.B[Symbol.hasInstance];
+    print({} instanceof t.B);
+}
+
+try {
+    print('basic');
+    basicTest();
+    print('shadowing');
+    shadowingTest();
+    print('delete');
+    deleteTest();
+    print('negative');
+    negativeTest();
+    print('setPrototypeOf');
+    setPrototypeOfTest();
+    print('defineProperty');
+    definePropertyTest();
+    print('primitives');
+    primitivesTest();
+    print('freed objects');
+    freedObjectsTest();
+    print('keys');
+    keysTest();
+    print('instanceof');
+    instanceofTest();
+} catch (e) {
+    print(e.stack || e);
+}
+
+print('done');
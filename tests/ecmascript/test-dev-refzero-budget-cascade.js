@@ -0,0 +1,166 @@
+/*
+ *  Deep refzero cascades with finalizers.  With DUK_USE_REFZERO_BUDGET a
+ *  cascade is freed in slices and the rest is resumed by later refzero
+ *  events, allocations, interrupts, mark-and-sweep, and heap destruction.
+ *  Every finalizer must still run exactly once, including finalizers which
+ *  create new garbage while a cascade is suspended.
+ *
+ *  Finalizable objects are not freed as part of a cascade (they go through
+ *  finalizer processing first), so the cascades here are chains and trees
+ *  of plain objects with finalizable objects hanging off them.
+ *
+ *  Run with a small budget, e.g. 'make ecmatest-refzero-budget'.
+ */
+
+/*===
+chain
+finalized 3000 missing 0 duplicate 0
+tree
+finalized 4096 missing 0 duplicate 0
+garbage creating finalizers
+finalized 3000 missing 0 duplicate 0
+interleaved cascades
+finalized 4000 missing 0 duplicate 0
+heap destruction
+===*/
+
+var counts;
+
+function reset(n) {
+    var i;
+    counts = [];
+    for (i = 0; i < n; i++) {
+        counts[i] = 0;
+    }
+}
+
+function finalizer(o, heapDestruct) {
+    counts[o.id]++;
+    if (counts[o.id] !== 1) {
+        print('finalizer for', o.id, 'ran', counts[o.id], 'times');
+    }
+}
+
+function garbageFinalizer(o, heapDestruct) {
+    var i, tmp;
+
+    finalizer(o, heapDestruct);
+
+    // Allocations run suspended cascade slices; new garbage is queued
+    // behind the suspended cascade.
+    for (i = 0; i < 5; i++) {
+        tmp = { ref: o, arr: [ i ] };
+    }
+    tmp = null;
+}
+
+function mkObj(id, fin) {
+    var obj = { id: id };
+    Duktape.fin(obj, fin || finalizer);
+    return obj;
+}
+
+function mkChain(base, n, fin) {
+    var head = null;
+    var i;
+
+    for (i = n - 1; i >= 0; i--) {
+        head = { fin: mkObj(base + i, fin), next: head };
+    }
+    return head;
+}
+
+function mkTree(depth, state) {
+    if (depth <= 0) {
+        return mkObj(state.id++);
+    }
+    return { left: mkTree(depth - 1, state), right: mkTree(depth - 1, state) };
+}
+
+function churn() {
+    // Refzero events and allocations to resume a suspended cascade.
+    var i, tmp;
+    for (i = 0; i < 100; i++) {
+        tmp = { i: i };
+    }
+}
+
+function check() {
+    var i, fin = 0, missing = 0, dup = 0;
+
+    churn();
+    Duktape.gc();
+    Duktape.gc();
+
+    for (i = 0; i < counts.length; i++) {
+        if (counts[i] === 0) {
+            missing++;
+        } else {
+            fin++;
+            if (counts[i] > 1) {
+                dup++;
+            }
+        }
+    }
+    print('finalized', fin, 'missing', missing, 'duplicate', dup);
+}
+
+function chainTest() {
+    var head;
+
+    reset(3000);
+    head = mkChain(0, 3000);
+    head = null;
+    check();
+}
+
+function treeTest() {
+    var root;
+
+    reset(4096);
+    root = mkTree(12, { id: 0 });
+    root = null;
+    check();
+}
+
+function garbageTest() {
+    var head;
+
+    reset(3000);
+    head = mkChain(0, 3000, garbageFinalizer);
+    head = null;
+    check();
+}
+
+function interleavedTest() {
+    var a, b;
+
+    // Start a second cascade while the first one may still be suspended.
+    reset(4000);
+    a = mkChain(0, 2000);
+    b = mkChain(2000, 2000);
+    a = null;
+    churn();
+    b = null;
+    check();
+}
+
+try {
+    print('chain');
+    chainTest();
+    print('tree');
+    treeTest();
+    print('garbage creating finalizers');
+    garbageTest();
+    print('interleaved cascades');
+    interleavedTest();
+
+    // Leave a large cascade for heap destruction to drain; any duplicate
+    // finalizer call is printed.
+    print('heap destruction');
+    reset(3000);
+    var last = mkChain(0, 3000);
+    last = null;
+} catch (e) {
+    print(e.stack || e);
+}
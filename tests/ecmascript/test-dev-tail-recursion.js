@@ -97,3 +97,156 @@ try {
 } catch (e) {
     print(e.name);
 }
+
+/*===
+1000000
+1000000
+1000000
+===*/
+
+/* A call in tail position of a conditional or logical expression is also
+ * a tail call, even though its result is copied into the expression's
+ * result register before returning.
+ */
+
+function sum3(a, b) {
+    return b == 0 ? a : sum3(a + 1, b - 1);
+}
+
+function sum4(a, b) {
+    return (b == 0 && a) || sum4(a + 1, b - 1);
+}
+
+function sum5(a, b) {
+    return b == 0 ? a : (b % 2 ? sum5(a + 1, b - 1) : sum5(a + 1, b - 1));
+}
+
+try {
+    print(sum3(0, 1000000));
+} catch (e) {
+    print(e.name);
+}
+
+try {
+    print(sum4(0, 1000000));
+} catch (e) {
+    print(e.name);
+}
+
+try {
+    print(sum5(0, 1000000));
+} catch (e) {
+    print(e.name);
+}
+
+/*===
+1000000
+RangeError
+===*/
+
+/* A 'with' statement doesn't catch anything, so it doesn't prevent a
+ * tail call.  A 'try' statement does.
+ */
+
+var withObj = { step: 1 };
+
+function sum6(a, b) {
+    with (withObj) {
+        if (b == 0) {
+            return a;
+        }
+        return sum6(a + step, b - step);
+    }
+}
+
+try {
+    print(sum6(0, 1000000));
+} catch (e) {
+    print(e.name);
+}
+
+function sum7(a, b) {
+    try {
+        if (b == 0) {
+            return a;
+        }
+        return sum7(a + 1, b - 1);
+    } catch (e) {
+        throw e;
+    }
+}
+
+try {
+    print(sum7(0, 1000000));
+} catch (e) {
+    print(e.name);
+}
+
+/*===
+1000000
+1000000
+===*/
+
+/* Bound functions and argument count mismatches don't prevent tail calls. */
+
+var sum8 = function (a, b, unused) {
+    if (b == 0) {
+        return a;
+    }
+    return sum8bound(a + 1, b - 1);
+};
+var sum8bound = sum8.bind(null);
+
+try {
+    print(sum8bound(0, 1000000));
+} catch (e) {
+    print(e.name);
+}
+
+function sum9(a, b) {
+    if (b == 0) {
+        return a;
+    }
+    return sum9(a + 1, b - 1, 'extra', 'args');
+}
+
+try {
+    print(sum9(0, 1000000));
+} catch (e) {
+    print(e.name);
+}
+
+/*===
+forEach
+TypeError
+===*/
+
+/* An activation called from native code can also tail call.  The tail
+ * called function replaces the callback activation and keeps preventing
+ * yield because the native caller is still on the C stack.
+ */
+
+function printCaller() {
+    // act(-1) = Duktape.act, act(-2) = printCaller, act(-3) = caller
+    print(Duktape.act(-3).function.name);
+}
+
+[ 1 ].forEach(function callback() {
+    return printCaller();
+});
+
+function doYield() {
+    Duktape.Thread.yield(123);
+}
+
+var thr = new Duktape.Thread(function () {
+    [ 1 ].forEach(function callback() {
+        // Tail call to an ECMAScript function; yield must still fail.
+        return doYield();
+    });
+});
+try {
+    Duktape.Thread.resume(thr);
+} catch (e) {
+    print(e.name);
+}
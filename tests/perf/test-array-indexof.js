@@ -0,0 +1,29 @@
+/*
+ *  Array.prototype.indexOf() and lastIndexOf() on a dense array
+ */
+
+if (typeof print !== 'function') { print = console.log; }
+
+function test() {
+    var arr = [];
+    var i;
+    var res = 0;
+
+    for (i = 0; i < 1e3; i++) {
+        arr.push(i % 2 ? 'value-' + i : i);
+    }
+
+    for (i = 0; i < 1e4; i++) {
+        res += arr.indexOf(999);     // not found, full scan
+        res += arr.lastIndexOf(0);   // found last
+        res += arr.indexOf('value-501');
+    }
+    print(res);
+}
+
+try {
+    test();
+} catch (e) {
+    print(e.stack || e);
+    throw e;
+}
@@ -0,0 +1,27 @@
+/*
+ *  Array.prototype.join() of integers and short strings
+ */
+
+if (typeof print !== 'function') { print = console.log; }
+
+function test() {
+    var arr = [];
+    var i;
+    var t;
+
+    for (i = 0; i < 1e4; i++) {
+        arr.push(i % 2 ? i * 1000 : 'item');
+    }
+
+    for (i = 0; i < 1e3; i++) {
+        t = arr.join(',');
+    }
+    print(t.length);
+}
+
+try {
+    test();
+} catch (e) {
+    print(e.stack || e);
+    throw e;
+}
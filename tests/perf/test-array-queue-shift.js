@@ -0,0 +1,30 @@
+/*
+ *  Array used as a FIFO queue with 1e5 elements: push() at the end,
+ *  shift() from the front.
+ */
+
+if (typeof print !== 'function') { print = console.log; }
+
+function test() {
+    var q = [];
+    var i, j;
+    var sum = 0;
+
+    for (i = 0; i < 1e5; i++) {
+        q.push(i);
+    }
+    for (i = 0; i < 10; i++) {
+        for (j = 0; j < 1e4; j++) {
+            sum += q.shift();
+            q.push(j);
+        }
+    }
+    print(q.length, sum);
+}
+
+try {
+    test();
+} catch (e) {
+    print(e.stack || e);
+    throw e;
+}
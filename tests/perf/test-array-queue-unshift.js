@@ -0,0 +1,30 @@
+/*
+ *  Array used as a queue with 1e5 elements: unshift() at the front,
+ *  pop() from the end.
+ */
+
+if (typeof print !== 'function') { print = console.log; }
+
+function test() {
+    var q = [];
+    var i, j;
+    var sum = 0;
+
+    for (i = 0; i < 1e5; i++) {
+        q.unshift(i);
+    }
+    for (i = 0; i < 10; i++) {
+        for (j = 0; j < 1e4; j++) {
+            sum += q.pop();
+            q.unshift(j);
+        }
+    }
+    print(q.length, sum);
+}
+
+try {
+    test();
+} catch (e) {
+    print(e.stack || e);
+    throw e;
+}
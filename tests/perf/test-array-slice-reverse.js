@@ -0,0 +1,28 @@
+/*
+ *  Array.prototype.slice() and reverse() on a dense array
+ */
+
+if (typeof print !== 'function') { print = console.log; }
+
+function test() {
+    var arr = [];
+    var i;
+    var tmp;
+
+    for (i = 0; i < 1e3; i++) {
+        arr.push({ index: i });
+    }
+
+    for (i = 0; i < 2e4; i++) {
+        tmp = arr.slice(100, 900);
+        tmp.reverse();
+    }
+    print(tmp.length, tmp[0].index);
+}
+
+try {
+    test();
+} catch (e) {
+    print(e.stack || e);
+    throw e;
+}
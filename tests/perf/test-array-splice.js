@@ -0,0 +1,28 @@
+/*
+ *  Array.prototype.splice() removing and inserting in the middle of a
+ *  1e5 element dense array.
+ */
+
+if (typeof print !== 'function') { print = console.log; }
+
+function test() {
+    var arr = [];
+    var i;
+    var removed;
+
+    for (i = 0; i < 1e5; i++) {
+        arr.push(i);
+    }
+    for (i = 0; i < 2e4; i++) {
+        removed = arr.splice(5e4, 2, 'x');
+        arr.splice(1e4, 0, removed[0]);
+    }
+    print(arr.length);
+}
+
+try {
+    test();
+} catch (e) {
+    print(e.stack || e);
+    throw e;
+}
@@ -0,0 +1,33 @@
+if (typeof print !== 'function') { print = console.log; }
+
+function mkobj(depth) {
+    var res = { foo: [ 1, 2, 'bar' ], bar: Math.cos };
+    var i;
+    if (depth <= 0) {
+        return res;
+    }
+    for (i = 0; i < 5; i++) {
+        res['key-' + i] = mkobj(depth - 1);
+    }
+    return res;
+}
+
+function test() {
+    var obj;
+    var i;
+
+    // Each iteration drops the last reference to a ~4k object graph,
+    // which is freed by a single refzero cascade.
+    for (i = 0; i < 100; i++) {
+        obj = mkobj(5);
+        obj = null;
+    }
+    print('done');
+}
+
+try {
+    test();
+} catch (e) {
+    print(e.stack || e);
+    throw e;
+}
@@ -0,0 +1,39 @@
+/*
+ *  'instanceof' performance for a class hierarchy
+ */
+
+if (typeof print !== 'function') { print = console.log; }
+
+function test() {
+    function A() {}
+    function B() {}
+    B.prototype = Object.create(A.prototype);
+    function C() {}
+    C.prototype = Object.create(B.prototype);
+
+    var obj = new C();
+    var other = {};
+    var i;
+    var ign;
+
+    for (i = 0; i < 1e6; i++) {
+        ign = obj instanceof A;
+        ign = obj instanceof B;
+        ign = obj instanceof C;
+        ign = other instanceof A;
+        ign = obj instanceof Object;
+        ign = obj instanceof A;
+        ign = obj instanceof B;
+        ign = obj instanceof C;
+        ign = other instanceof A;
+        ign = obj instanceof Object;
+    }
+    print(ign);
+}
+
+try {
+    test();
+} catch (e) {
+    print(e.stack || e);
+    throw e;
+}
@@ -0,0 +1,42 @@
+/*
+ *  Property read performance for a property inherited from several levels
+ *  up the prototype chain
+ */
+
+if (typeof print !== 'function') { print = console.log; }
+
+function test() {
+    var root = { foo: 123 };
+    var obj = root;
+    var i;
+    var ign;
+
+    for (i = 0; i < 5; i++) {
+        obj = Object.create(obj);
+        obj['xxx' + i] = i;
+        obj['yyy' + i] = i;
+        obj['zzz' + i] = i;
+    }
+    obj = Object.create(obj);  // six levels of inheritance
+
+    for (i = 0; i < 1e6; i++) {
+        ign = obj.foo;
+        ign = obj.foo;
+        ign = obj.foo;
+        ign = obj.foo;
+        ign = obj.foo;
+        ign = obj.foo;
+        ign = obj.foo;
+        ign = obj.foo;
+        ign = obj.foo;
+        ign = obj.foo;
+    }
+    print(ign);
+}
+
+try {
+    test();
+} catch (e) {
+    print(e.stack || e);
+    throw e;
+}
@@ -0,0 +1,31 @@
+/*
+ *  Built-in (native) getter property read performance
+ */
+
+if (typeof print !== 'function') { print = console.log; }
+
+function test() {
+    var u8 = new Uint8Array(256).subarray(16, 32);
+    var i;
+    var ign;
+
+    for (i = 0; i < 1e6; i++) {
+        ign = u8.byteLength;
+        ign = u8.byteOffset;
+        ign = u8.byteLength;
+        ign = u8.byteOffset;
+        ign = u8.byteLength;
+        ign = u8.byteOffset;
+        ign = u8.byteLength;
+        ign = u8.byteOffset;
+        ign = u8.byteLength;
+        ign = u8.byteOffset;
+    }
+}
+
+try {
+    test();
+} catch (e) {
+    print(e.stack || e);
+    throw e;
+}
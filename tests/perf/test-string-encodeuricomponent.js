@@ -0,0 +1,31 @@
+/*
+ *  Test encodeURIComponent() and decodeURIComponent() for query string
+ *  like input with a mix of unescaped runs and escaped characters.
+ */
+
+if (typeof print !== 'function') { print = console.log; }
+
+function test() {
+    var txt = 'name=John Smith&city=Zürich&q=a+b/c?d#e&price=€10&tags=foo,bar;baz&id=1234567890&';
+    var enc;
+    var i;
+
+    for (i = 0; i < 8; i++) {
+        txt = txt + txt;
+    }
+    enc = encodeURIComponent(txt);
+
+    print(txt.length, enc.length);
+
+    for (i = 0; i < 5000; i++) {
+        void encodeURIComponent(txt);
+        void decodeURIComponent(enc);
+    }
+}
+
+try {
+    test();
+} catch (e) {
+    print(e.stack || e);
+    throw e;
+}
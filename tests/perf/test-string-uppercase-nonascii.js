@@ -0,0 +1,29 @@
+/*
+ *  Test string uppercasing and lowercasing for Cyrillic and Latin-1 text
+ *  (lookup table path).
+ */
+
+if (typeof print !== 'function') { print = console.log; }
+
+function test() {
+    var txt = 'Съешь же ещё этих мягких французских булок, да выпей чаю. Größe Übung für Ærø. ';
+    var i;
+
+    for (i = 0; i < 10; i++) {
+        txt = txt + txt;
+    }
+
+    print(txt.length);
+
+    for (i = 0; i < 100; i++) {
+        void txt.toUpperCase();
+        void txt.toLowerCase();
+    }
+}
+
+try {
+    test();
+} catch (e) {
+    print(e.stack || e);
+    throw e;
+}
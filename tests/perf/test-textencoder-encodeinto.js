@@ -0,0 +1,35 @@
+/*
+ *  TextEncoder .encodeInto() with a reused output buffer, e.g. for
+ *  network framing.
+ */
+
+if (typeof print !== 'function') { print = console.log; }
+
+function test() {
+    var te = new TextEncoder();
+    var out = new Uint8Array(4096);
+    var msgs = [];
+    var i, j, res, total;
+
+    for (i = 0; i < 64; i++) {
+        msgs.push('{"id":' + i + ',"type":"update","name":"café €' + i + '","payload":"' +
+                  new Array(i + 2).join('abcdefgh') + '"}');
+    }
+
+    total = 0;
+    for (i = 0; i < 20000; i++) {
+        for (j = 0; j < msgs.length; j++) {
+            res = te.encodeInto(msgs[j], out);
+            total += res.written;
+        }
+    }
+
+    print(total);
+}
+
+try {
+    test();
+} catch (e) {
+    print(e.stack || e);
+    throw e;
+}
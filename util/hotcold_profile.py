@@ -0,0 +1,114 @@
+#!/usr/bin/env python
+#
+#  Add a 'hot' function list to a hot/cold profile from gprof flat profiles
+#  of your own workload, e.g. using a 'duk' built with -pg:
+#
+#    $ ./duk-pg myapp1.js && mv gmon.out gmon.1
+#    $ ./duk-pg myapp2.js && mv gmon.out gmon.2
+#    $ gprof -s ./duk-pg gmon.1 gmon.2 && gprof -b -p ./duk-pg gmon.sum > flat.txt
+#    $ cp src-input/hotcold.yaml myapp_hotcold.yaml
+#    $ python util/hotcold_profile.py --flat-profile flat.txt \
+#          --source-directory src-input --profile myapp_hotcold.yaml
+#
+#  and then configure with '--hotcold-profile myapp_hotcold.yaml'.  Check
+#  the result for plausibility: gprof attribution can be unreliable for
+#  optimized builds.
+#
+#  Functions are selected by decreasing self time until the selected
+#  functions cover --coverage of the total self time, up to --max-count
+#  functions.  Only functions defined in the Duktape sources, outside the
+#  profile's 'cold_files', are included.
+#  Everything before the 'hot:' key in the profile (the hand maintained
+#  cold lists) is kept as is.
+#
+#  Should be Python2 and Python3 compatible.
+
+import os
+import re
+import sys
+import optparse
+import yaml
+
+re_func_start = re.compile(r'^(?:DUK_INTERNAL|DUK_LOCAL|DUK_EXTERNAL)\s+[^=;(]*?\b([A-Za-z_]\w*)\(')
+
+def scan_defined_functions(source_dir):
+    res = {}
+    for fn in sorted(os.listdir(source_dir)):
+        if not fn.endswith('.c'):
+            continue
+        with open(os.path.join(source_dir, fn), 'r') as f:
+            for line in f:
+                m = re_func_start.match(line)
+                if m is not None:
+                    res[m.group(1)] = fn
+    return res
+
+def parse_flat_profile(fn, times):
+    # Flat profile rows:
+    #   %   cumulative   self              self     total
+    #  time   seconds   seconds    calls  ms/call  ms/call  name
+    #  35.01      1.96     1.96  1234567     0.00     0.00  duk_js_execute_bytecode
+    with open(fn, 'r') as f:
+        for line in f:
+            parts = line.split()
+            if len(parts) < 4:
+                continue
+            try:
+                self_time = float(parts[2])
+            except ValueError:
+                continue
+            # Strip GCC clone suffixes like .constprop.0, .isra.0, .part.0.
+            name = parts[-1].split('.')[0]
+            times[name] = times.get(name, 0.0) + self_time
+
+def main():
+    parser = optparse.OptionParser()
+    parser.add_option('--flat-profile', dest='flat_profiles', action='append', default=[], help='gprof flat profile (gprof -b -p), may be given multiple times')
+    parser.add_option('--source-directory', dest='source_directory', default='src-input', help='Duktape source directory')
+    parser.add_option('--profile', dest='profile', help='Hot/cold profile YAML file to update')
+    parser.add_option('--coverage', type='float', dest='coverage', default=0.95, help='Fraction of total self time covered by hot functions')
+    parser.add_option('--max-count', type='int', dest='max_count', default=150, help='Maximum number of hot functions')
+    (opts, args) = parser.parse_args()
+
+    if len(opts.flat_profiles) == 0:
+        raise Exception('no --flat-profile given')
+    if opts.profile is None:
+        raise Exception('no --profile given')
+
+    with open(opts.profile, 'r') as f:
+        data = f.read()
+    cold_files = (yaml.safe_load(data) or {}).get('cold_files') or []
+
+    defined = scan_defined_functions(opts.source_directory)
+    times = {}
+    for fn in opts.flat_profiles:
+        parse_flat_profile(fn, times)
+    funcs = sorted([ k for k in times.keys() if k in defined and defined[k] not in cold_files and times[k] > 0.0 ], key=lambda k: (-times[k], k))
+    total = sum([ times[k] for k in funcs ])
+
+    hot = []
+    covered = 0.0
+    for k in funcs:
+        if covered >= opts.coverage * total or len(hot) >= opts.max_count:
+            break
+        hot.append(k)
+        covered += times[k]
+    sys.stderr.write('selected %d hot functions covering %.1f%% of %.2f seconds self time\n' % \
+                     (len(hot), (100.0 * covered / total if total > 0 else 0.0), total))
+
+    keep = []
+    for line in data.split('\n'):
+        if line.startswith('hot:'):
+            break
+        keep.append(line)
+    while len(keep) > 0 and keep[-1] == '':
+        keep.pop()
+
+    out = keep + [ '', 'hot:' ]
+    for k in sorted(hot, key=lambda k: (defined[k], k)):
+        out.append('  - %s  # %s' % (k, defined[k]))
+    with open(opts.profile, 'w') as f:
+        f.write('\n'.join(out) + '\n')
+
+if __name__ == '__main__':
+    main()